@@ -104,23 +104,24 @@ def setup(app):
     ####################################################################################
     from textwrap import dedent
 
-    from exhale.configs import DEFAULT_DOXYGEN_STDIN_BASE
-    default_parts = DEFAULT_DOXYGEN_STDIN_BASE.strip().splitlines()
-    multiline_var = "\n   ".join(p for p in default_parts)
-    with open("DEFAULT_DOXYGEN_STDIN_BASE_value.rst", "w") as dcv:
-        dcv.write(dedent("""
-            The value of this variable is a multiline string with contents:
-
-            .. code-block:: py
-
-        """))
-        dcv.write("   {multiline_var}".format(multiline_var=multiline_var))
-        dcv.write(dedent("""
-            .. note::
-
-               The above value is presented for readability, when using this variable
-               take note of any leading or trailing ``\\n`` characters.
-        """))
+    from exhale import configs as exhale_configs
+    for stdin_var in ("DEFAULT_DOXYGEN_STDIN_BASE", "DEFAULT_DOXYGEN_STDIN_LEAN"):
+        default_parts = getattr(exhale_configs, stdin_var).strip().splitlines()
+        multiline_var = "\n   ".join(p for p in default_parts)
+        with open("{0}_value.rst".format(stdin_var), "w") as dcv:
+            dcv.write(dedent("""
+                The value of this variable is a multiline string with contents:
+
+                .. code-block:: py
+
+            """))
+            dcv.write("   {multiline_var}".format(multiline_var=multiline_var))
+            dcv.write(dedent("""
+                .. note::
+
+                   The above value is presented for readability, when using this variable
+                   take note of any leading or trailing ``\\n`` characters.
+            """))
 
     from exhale.utils import LANG_TO_LEX
     longest = 0
@@ -16,6 +16,11 @@ def environment_ready(app):
     from . import configs
     from . import utils
     from . import deploy
+    # Every project in exhale_projects is configured and generated together.
+    if app.config.exhale_projects:
+        deploy.explodeProjects(app)
+        return
+
     # First, setup the extension and verify all of the configurations.
     configs.apply_sphinx_configurations(app)
     ####### Next, perform any cleanup
@@ -27,6 +32,24 @@ def environment_ready(app):
         utils.fancyError("Exhale: could not generate reStructuredText documents :/")
 
 
+def source_read(app, docname, source):
+    # Documents deferred by configs.onDemandGeneration are generated as they are read.
+    # This may be a parallel read worker, which inherits app.exhale_root when forked.
+    root = getattr(app, "exhale_root", None)
+    if root is None or not root.on_demand_documents:
+        return
+    contents = root.renderOnDemandDocument(docname)
+    if contents is not None:
+        source[0] = contents
+
+
+def build_finished(app, exception):
+    # Documents deferred by configs.onDemandGeneration are all read now.
+    root = getattr(app, "exhale_root", None)
+    if root is not None:
+        root.storage.close()
+
+
 # TODO:
 # This is not the correct event for cleanup of this project, as we want to allow the
 # users to view the generated reStructuredText / Doxygen xml.  What needs to be done is
@@ -39,14 +62,18 @@ def cleanup_files(app, env, docname):
 def setup(app):
     app.setup_extension("breathe")
     app.add_config_value("exhale_args", {}, "env")
+    app.add_config_value("exhale_projects", {}, "env")
 
     app.connect("builder-inited", environment_ready)
+    app.connect("source-read", source_read)
+    app.connect("build-finished", build_finished)
     # app.connect("env-purge-doc", cleanup_files)
 
     return {
         "version": __version__,
         # Because Exhale hooks into / generates *BEFORE* any reading or writing occurs,
-        # it is parallel safe by default.
+        # it is parallel safe by default.  With configs.onDemandGeneration the graph is
+        # still built before reading, workers only render documents from it.
         "parallel_read_safe": True,
         "parallel_write_safe": True
     }
@@ -0,0 +1,15 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+"""Enables ``python -m exhale``, see :mod:`exhale.cli`."""
+
+import sys
+
+from .cli import main
+
+if __name__ == "__main__":
+    sys.exit(main())
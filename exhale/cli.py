@@ -0,0 +1,326 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+'''
+The ``cli`` module runs Exhale **without** Sphinx, so that build systems such as Make or
+Ninja can schedule, cache, and parallelize generating the ``containmentFolder`` like
+any other build step.  It is available as either ``exhale`` or ``python -m exhale``:
+
+.. code-block:: console
+
+   $ exhale --config docs/conf.py --xml-dir build/doxyoutput/xml \\
+            --depfile build/exhale.d
+
+The ``--config`` file is executed as Python (your existing ``conf.py`` works) or read as
+JSON when it ends in ``.json``.  It must define ``exhale_args``; ``breathe_projects``
+and ``breathe_default_project`` are only needed when ``--xml-dir`` is not given.  All
+paths in ``exhale_args`` are interpreted relative to the directory of the config file,
+exactly as they would be by Sphinx.  When it defines ``exhale_projects`` (see
+:class:`~exhale.configs.ProjectConfigs`), every project is generated.
+
+When ``--depfile`` is given, a Make / Ninja compatible dependency file is written
+listing every generated document as a target of every Doxygen XML document read.
+Ninja only understands depfiles with a single target, use ``--depfile-target`` to name
+the (stamp) output of your build edge:
+
+.. code-block:: ninja
+
+   rule exhale
+     command = exhale -c $conf -x $xml -d $out.d -t $out && touch $out
+     depfile = $out.d
+     deps = gcc
+'''
+
+from __future__ import unicode_literals
+
+from . import __version__
+
+import argparse
+import codecs
+import json
+import logging
+import os
+import sys
+
+
+class _StandaloneRegistry(object):
+    '''
+    Stand-in for ``sphinx.registry.SphinxComponentRegistry`` tracking the tree view
+    stylesheets and javascript requested by
+    :func:`~exhale.configs.apply_sphinx_configurations`.
+    '''
+    def __init__(self):
+        self.css_files = []
+        self.js_files  = []
+
+
+class _StandaloneConfig(object):
+    '''
+    Stand-in for ``sphinx.config.Config``, exposing the values Exhale reads.
+
+    **Parameters**
+        ``values`` (:class:`python:dict`)
+            The variables defined by the configuration file.
+    '''
+    def __init__(self, values):
+        self.exhale_args             = values.get("exhale_args", {})
+        self.exhale_projects         = values.get("exhale_projects", {})
+        self.breathe_projects        = values.get("breathe_projects", {})
+        self.breathe_default_project = values.get("breathe_default_project", None)
+        self.source_suffix           = values.get("source_suffix", {".rst": "restructuredtext"})
+        self.html_static_path        = list(values.get("html_static_path", []))
+
+
+class StandaloneApplication(object):
+    '''
+    The minimal subset of :class:`sphinx.application.Sphinx` that Exhale uses, so that
+    :func:`~exhale.configs.apply_sphinx_configurations` and
+    :func:`~exhale.deploy.explode` can run without starting Sphinx.
+
+    **Parameters**
+        ``confdir`` (str)
+            The directory paths in ``exhale_args`` are relative to.
+
+        ``srcdir`` (str)
+            The Sphinx source directory, ``containmentFolder`` must be below it.
+
+        ``values`` (:class:`python:dict`)
+            The variables defined by the configuration file.
+    '''
+    def __init__(self, confdir, srcdir, values):
+        self.confdir     = os.path.abspath(confdir)
+        self.srcdir      = os.path.abspath(srcdir)
+        self.config      = _StandaloneConfig(values)
+        self.registry    = _StandaloneRegistry()
+        self.exhale_root = None
+
+    def add_css_file(self, filename, **kwargs):
+        self.registry.css_files.append((filename, kwargs))
+
+    def add_js_file(self, filename, **kwargs):
+        self.registry.js_files.append((filename, kwargs))
+
+
+def load_config_file(path):
+    '''
+    Load the variables defined by ``path``.
+
+    **Parameters**
+        ``path`` (str)
+            A ``.json`` file containing an object, or a Python file (e.g., ``conf.py``)
+            to execute.
+
+    **Return**
+        :class:`python:dict`
+            The variables defined, at least ``exhale_args`` is expected to be present.
+    '''
+    with codecs.open(path, "r", "utf-8") as config_file:
+        contents = config_file.read()
+
+    if path.endswith(".json"):
+        values = json.loads(contents)
+        if not isinstance(values, dict):
+            raise ValueError("The JSON config file [{0}] must contain an object.".format(path))
+        return values
+
+    # Mirror sphinx.config.eval_config_file: run from the directory of the file.
+    values = {"__file__": os.path.abspath(path)}
+    here = os.path.abspath(os.curdir)
+    try:
+        os.chdir(os.path.dirname(os.path.abspath(path)))
+        code = compile(contents, path, "exec")
+        exec(code, values)
+    finally:
+        os.chdir(here)
+    return values
+
+
+def xml_inputs(root):
+    '''
+    Gather the Doxygen XML documents that went into generating ``root``.
+
+    **Parameters**
+        ``root`` (:class:`~exhale.graph.ExhaleRoot`)
+            The parsed and generated graph.
+
+    **Return**
+        :class:`python:list` of str
+            The sorted absolute paths of ``index.xml`` and every ``{refid}.xml`` that
+            exists for a node in the graph.  Only the archive, or
+            :data:`~exhale.configs.doxygenCombinedXML`, when one of those was used.
+    '''
+    from . import configs
+    from . import utils
+    if configs.doxygenCombinedXML:
+        return [configs.doxygenCombinedXML]
+    if utils.doxygenXMLArchive() is not None:
+        return [configs._doxygen_xml_output_directory]
+    xml_dir = configs._doxygen_xml_output_directory
+    documents = utils.doxygenXMLDocuments()
+    inputs = {os.path.join(xml_dir, "index.xml")}
+    for node in root.all_nodes:
+        name = documents.get("{0}.xml".format(node.refid), None)
+        if name is not None:
+            inputs.add(os.path.join(xml_dir, *name.split("/")))
+    return sorted(inputs)
+
+
+def generated_outputs(root):
+    '''
+    Gather the documents written by :func:`~exhale.graph.ExhaleRoot.generateFullAPI`.
+
+    **Parameters**
+        ``root`` (:class:`~exhale.graph.ExhaleRoot`)
+            The parsed and generated graph.
+
+    **Return**
+        :class:`python:list` of str
+            The sorted absolute paths of every generated document.
+    '''
+    return root.generatedDocuments()
+
+
+def _depfile_escape(path):
+    # Both GNU Make and Ninja understand backslash escaped spaces and `$$`.
+    return path.replace(" ", "\\ ").replace("#", "\\#").replace("$", "$$")
+
+
+def write_depfile(depfile, targets, dependencies):
+    '''
+    Write a Make / Ninja dependency file.
+
+    **Parameters**
+        ``depfile`` (str)
+            The path to write to.
+
+        ``targets`` (:class:`python:list` of str)
+            The outputs of the rule.
+
+        ``dependencies`` (:class:`python:list` of str)
+            The inputs the ``targets`` depend on.
+    '''
+    depfile_dir = os.path.dirname(os.path.abspath(depfile))
+    if not os.path.isdir(depfile_dir):
+        os.makedirs(depfile_dir)
+    with codecs.open(depfile, "w", "utf-8") as dep:
+        dep.write(" \\\n  ".join(_depfile_escape(t) for t in targets))
+        dep.write(":")
+        for d in dependencies:
+            dep.write(" \\\n  {0}".format(_depfile_escape(d)))
+        dep.write("\n")
+
+
+def _make_parser():
+    parser = argparse.ArgumentParser(
+        prog="exhale",
+        description="Generate the Exhale reStructuredText API documents without Sphinx."
+    )
+    parser.add_argument(
+        "-c", "--config", required=True,
+        help="A Python (e.g., conf.py) or .json file defining `exhale_args`."
+    )
+    parser.add_argument(
+        "-x", "--xml-dir", default=None,
+        help="The Doxygen XML directory (or a .zip / .tar[.gz|.xz|.zst] archive of it), "
+             "overrides `breathe_projects[breathe_default_project]`."
+    )
+    parser.add_argument(
+        "-s", "--srcdir", default=None,
+        help="The Sphinx source directory (default: the directory of --config)."
+    )
+    parser.add_argument(
+        "-d", "--depfile", default=None,
+        help="Write a Make / Ninja dependency file here."
+    )
+    parser.add_argument(
+        "-t", "--depfile-target", default=None,
+        help="Use this as the only target in --depfile rather than every generated document."
+    )
+    parser.add_argument("--version", action="version", version="%(prog)s {0}".format(__version__))
+    return parser
+
+
+def main(argv=None):
+    '''
+    Entry point for the ``exhale`` command.
+
+    **Parameters**
+        ``argv`` (:class:`python:list` of str or ``None``)
+            The command line arguments, ``sys.argv[1:]`` when ``None``.
+
+    **Return**
+        int
+            The process exit code.
+    '''
+    args = _make_parser().parse_args(argv)
+
+    # Defer importing until arguments are parsed, `--help` should not need Sphinx.
+    from sphinx.errors import SphinxError
+
+    from . import configs
+    from . import deploy
+    from . import utils
+
+    # The configs module reports through sphinx.util.logging, which is only wired up to
+    # the console when Sphinx is running.
+    logging.basicConfig(level=logging.INFO, format="%(message)s", stream=sys.stdout)
+
+    config_path = os.path.abspath(args.config)
+    confdir = os.path.dirname(config_path)
+    srcdir = os.path.abspath(args.srcdir) if args.srcdir else confdir
+    try:
+        values = load_config_file(config_path)
+    except Exception as e:
+        sys.stderr.write(utils.critical("Unable to load [{0}]: {1}\n".format(config_path, e)))
+        return 1
+
+    if args.xml_dir:
+        values["breathe_projects"] = {"exhale": os.path.abspath(args.xml_dir)}
+        values["breathe_default_project"] = "exhale"
+
+    app = StandaloneApplication(confdir, srcdir, values)
+    if app.config.exhale_projects:
+        if args.depfile or args.xml_dir:
+            sys.stderr.write(utils.critical(
+                "--depfile and --xml-dir cannot be used with `exhale_projects`.\n"
+            ))
+            return 1
+        try:
+            deploy.explodeProjects(app, on_demand=False)
+        except SphinxError as e:
+            sys.stderr.write(utils.critical("{0}\n".format(e)))
+            return 1
+        return 0
+
+    try:
+        configs.apply_sphinx_configurations(app)
+    except SphinxError as e:
+        sys.stderr.write(utils.critical("{0}\n".format(e)))
+        return 1
+
+    # There is no Sphinx reading documents to generate them on demand.
+    if configs.onDemandGeneration:
+        sys.stdout.write("{0}\n".format(utils.info(
+            "Exhale: `onDemandGeneration` ignored, generating all documents."
+        )))
+        configs.onDemandGeneration = False
+
+    deploy.explode()
+
+    if args.depfile:
+        root = app.exhale_root
+        inputs = xml_inputs(root)
+        outputs = generated_outputs(root)
+        targets = [os.path.abspath(args.depfile_target)] if args.depfile_target else outputs
+        write_depfile(args.depfile, targets, inputs)
+        sys.stdout.write("{0}\n".format(utils.progress(
+            "Exhale: wrote dependency file [{0}] ({1} inputs, {2} outputs).".format(
+                args.depfile, len(inputs), len(outputs)
+            )
+        )))
+
+    return 0
@@ -42,6 +42,7 @@ follows:
 
 from __future__ import unicode_literals
 
+import hashlib
 import os
 import six
 import textwrap
@@ -247,7 +248,9 @@ verboseBuild = False
     .. warning::
 
        There is only one level of verbosity: excessively verbose.  **All logging is
-       written to** ``sys.stderr``.  See :data:`~exhale.configs.alwaysColorize`.
+       written to** the ``INFO`` level of the Sphinx logger, or to
+       :data:`~exhale.configs.verboseBuildFile` when it is set.  See
+       :data:`~exhale.configs.alwaysColorize`.
 
     .. tip::
 
@@ -257,6 +260,26 @@ verboseBuild = False
        with the code locally.
 '''
 
+verboseBuildFile = None
+'''
+**Optional**
+    Where to write the output of :data:`~exhale.configs.verboseBuild`, rather than the
+    console.  For large projects the verbose output is far too long to read in a
+    terminal, and writing it to a file (without color) is much faster.
+
+**Value in** ``exhale_args`` (str)
+    The path to the file, relative to the directory of ``conf.py`` (or absolute).  The
+    file is replaced every build.  It has no effect unless
+    :data:`~exhale.configs.verboseBuild` is ``True``.
+
+    .. note::
+
+       When several projects are documented (see ``exhale_projects``) and generated in
+       parallel processes, give each of them a file of its own: ``{project}`` is
+       replaced with the name of the project (see
+       :data:`~exhale.configs.PROJECT_FILES`).
+'''
+
 alwaysColorize = True
 '''
 **Optional**
@@ -459,6 +482,29 @@ listingExclude = []
 # TODO: moves into config object
 _compiled_listing_exclude = []
 
+listingExcludeDoxygen = False
+'''
+**Optional**
+    Exclude the items matched by :data:`~exhale.configs.listingExclude` from the
+    documentation **entirely**, rather than only from the listings.
+
+**Value in** ``exhale_args`` (bool)
+    When ``True``, anything whose fully qualified name (or an enclosing scope's name)
+    matches ``listingExclude`` is skipped when Exhale reads the Doxygen XML, so it is
+    not parsed and no page is generated for it.  When
+    :data:`~exhale.configs.exhaleExecutesDoxygen` is ``True``, the patterns are also
+    sent to Doxygen as ``EXCLUDE_SYMBOLS`` (see
+    :func:`~exhale.utils.doxygenExcludeSymbol`), so Doxygen does not process them
+    either.  Patterns that cannot be expressed with Doxygen's ``*`` wildcard, or that
+    use flags such as :data:`python:re.IGNORECASE`, are still skipped by Exhale.
+
+    .. note::
+
+       The items will also be missing from the file pages and the full API listing.
+       If Breathe directives elsewhere in your documentation refer to them, Doxygen
+       will no longer have documentation for them to find.
+'''
+
 unabridgedOrphanKinds = {"dir", "file", "page"}
 """
 **Optional**
@@ -1000,6 +1046,14 @@ simply be ``./_doxygen/xml``.
 
    This is the exact same path as ``breathe_projects[breathe_default_project]``, only it
    is an absolute path.
+
+It may also be an archive of the Doxygen XML output (any of
+:data:`~exhale.utils.DOXYGEN_XML_ARCHIVE_SUFFIXES`), which Exhale reads in place with
+:class:`~exhale.utils.DoxygenXMLArchive`.  Breathe can only read a directory, so this is
+intended for the standalone ``exhale`` command (``exhale --xml-dir xml.zip ...``).  Only
+an index of the archive is kept in memory.  ``.zip`` and ``.tar`` archives are read in
+place, compressed tarballs are first decompressed to a temporary ``.tar`` (disk space
+the size of the XML output, removed again after the build).
 '''
 
 exhaleExecutesDoxygen = False
@@ -1060,7 +1114,7 @@ exhaleDoxygenStdin = None
 '''
 
 DEFAULT_DOXYGEN_STDIN_BASE = textwrap.dedent(r'''
-    # If you need this to be YES, exhale will probably break.
+    # Exhale finds documents in sub-directories, but Breathe expects {refid}.xml.
     CREATE_SUBDIRS         = NO
     # So that only Doxygen does not trim paths, which affects the File hierarchy
     FULL_PATH_NAMES        = YES
@@ -1102,6 +1156,44 @@ defaults shown here.
 .. include:: ../DEFAULT_DOXYGEN_STDIN_BASE_value.rst
 '''
 
+exhaleDoxygenLean = False
+'''
+**Optional**
+    If :data:`~exhale.configs.exhaleExecutesDoxygen` is ``True``, also send the
+    :data:`~exhale.configs.DEFAULT_DOXYGEN_STDIN_LEAN` profile to Doxygen.
+
+**Value in** ``exhale_args`` (bool)
+    Turning off the XML Exhale does not need roughly halves both the Doxygen runtime and
+    the size of its output.  The file an item was defined in is recovered from the
+    ``<location>`` Doxygen writes for it, so the file hierarchy and file pages are the
+    same as without this profile.
+
+    .. note::
+
+       The program listing pages linked from every file page are generated from the
+       ``<programlisting>``, which this profile disables.  If you want them, do not
+       use this option (or override ``XML_PROGRAMLISTING = YES`` in your
+       :data:`~exhale.configs.exhaleDoxygenStdin`).
+'''
+
+DEFAULT_DOXYGEN_STDIN_LEAN = textwrap.dedent(r'''
+    # Exhale recovers file ownership from <location>, the listing is not needed.
+    XML_PROGRAMLISTING     = NO
+    # Neither Exhale nor Breathe use the source browser or cross references.
+    SOURCE_BROWSER         = NO
+    INLINE_SOURCES         = NO
+    REFERENCED_BY_RELATION = NO
+    REFERENCES_RELATION    = NO
+''')
+'''
+The values sent to Doxygen along stdin when :data:`~exhale.configs.exhaleDoxygenLean`
+is ``True``.  This is sent immediately **after** the
+:data:`~exhale.configs.DEFAULT_DOXYGEN_STDIN_BASE` and **before** the
+:data:`~exhale.configs.exhaleDoxygenStdin`, which can still override any of them.
+
+.. include:: ../DEFAULT_DOXYGEN_STDIN_LEAN_value.rst
+'''
+
 exhaleSilentDoxygen = False
 '''
 **Optional**
@@ -1109,7 +1201,10 @@ exhaleSilentDoxygen = False
 
 **Value in** ``exhale_args`` (bool)
     Documentation generation can be quite verbose, especially when running both Sphinx
-    and Doxygen in the same process.  Use this to silence Doxygen.
+    and Doxygen in the same process.  Use this to silence Doxygen.  The output is
+    still followed, so the phases of Doxygen are still recorded (see
+    :data:`~exhale.configs.metricsFile`), but neither it nor the summary of the
+    slowest phases and the warnings is printed.
 
     .. danger::
 
@@ -1235,6 +1330,271 @@ dictionary is created by compiling every key in
 for usage.
 '''
 
+########################################################################################
+# Build Performance                                                                    #
+########################################################################################
+onDemandGeneration = False
+'''
+**Optional**
+    Only compute the graph and the list of documents up front, and generate the
+    reStructuredText for each node document when Sphinx reads it.
+
+**Value in** ``exhale_args`` (bool)
+    By default every document is generated in the ``builder-inited`` event, before Sphinx
+    starts reading.  When set to ``True``, Exhale still parses the Doxygen XML and writes
+    the root document, hierarchies, and unabridged API up front.  The documents for
+    every class, namespace, file, etc are written as small placeholders and are filled
+    in during the `source-read`__ event.  With ``sphinx-build -j N`` the generation is
+    spread across the parallel read worker processes, and documents Sphinx decides not
+    to re-read are never generated at all.
+
+    __ https://www.sphinx-doc.org/en/master/extdev/appapi.html#event-source-read
+
+    A placeholder is only rewritten when the Doxygen XML it was generated from changes,
+    which is what lets Sphinx skip re-reading it on incremental builds.
+
+    .. note::
+
+       The documents on disk are placeholders, the generated reStructuredText only
+       exists inside of Sphinx.  Leave this ``False`` when inspecting the generated
+       documents, or when running the standalone ``exhale`` command (which ignores it).
+'''
+
+nativeMemberRendering = False
+'''
+**Optional**
+    Document functions, variables, typedefs, enums, and defines with the Sphinx C++
+    (and C, for defines) domain directives directly rather than Breathe's.
+
+**Value in** ``exhale_args`` (bool)
+    By default the leaf pages of these kinds use e.g. ``.. doxygenfunction::``, which
+    makes Breathe search the Doxygen XML for a member matching the name and signature.
+    For heavily overloaded names this search is slow, and it can resolve to the wrong
+    overload (see the warnings from :func:`~exhale.graph.ExhaleRoot.adjustFunctionTitles`).
+    Exhale already knows the exact ``<memberdef>`` of every leaf, so when set to ``True``
+    it is rendered with ``.. cpp:function::``, ``.. cpp:var::``, ``.. cpp:type::``,
+    ``.. cpp:enum::``, or ``.. c:macro::``, and the brief and detailed descriptions are
+    converted the same way as for file and namespace pages.  Anything that cannot be
+    rendered this way (such as anonymous enums) still uses the Breathe directive.
+
+    A ``.. _{refid}:`` label is placed before each directive, so references to the member
+    from documents Breathe generates still resolve.
+
+    .. note::
+
+       Description markup is converted by :func:`~exhale.parse.walk`, which supports
+       fewer Doxygen commands than Breathe.  Parameter, return, and exception lists as
+       well as ``\\note``, ``\\warning``, and ``\\see`` are converted to their Sphinx
+       equivalents.  Do not combine this with
+       :data:`~exhale.configs.generateBreatheFileDirectives`, which documents the same
+       members (and labels) a second time.
+'''
+
+contentStoreDirectory = None
+'''
+**Optional**
+    A directory shared between builds (e.g., the documentation of every release branch)
+    where generated documents are stored by the ``sha256`` of their contents.
+
+**Value in** ``exhale_args`` (str)
+    After generating, every document in :data:`~exhale.configs.containmentFolder` is
+    moved into ``{contentStoreDirectory}/objects/`` unless identical content is already
+    there, and replaced by a hard link to the stored object (or a copy of it, when hard
+    links are not possible).  A document that is byte-identical to one generated by any
+    earlier build (of any checkout sharing the store) is therefore stored once, even the
+    first time a fresh checkout is built.  The mapping from each document to its hash is
+    written to ``{containmentFolder}/exhale_manifest.json``.  A document with the same
+    hash as in the previous manifest keeps the modification time of the stored object,
+    so Sphinx does not re-read it.  Any other document (even with contents already in
+    the store, e.g., after a revert) is given the current time, so Sphinx re-reads it.
+    Other builds linked to the same object see the new time as well, and re-read the
+    (identical) document once.
+
+    As with :data:`~exhale.configs.containmentFolder`, relative paths are relative to
+    the directory ``conf.py`` is in.
+
+    .. note::
+
+       Exhale never writes through a link into the store, documents are unlinked before
+       they are regenerated.  Do not edit the generated documents by hand, as with a
+       hard link you would be editing the stored object for every build using it.
+'''
+
+doxygenCombinedXML = None
+'''
+**Optional**
+    Read every compound from the single file created by Doxygen's ``combine.xslt``
+    rather than ``index.xml`` and one ``{refid}.xml`` per compound.
+
+**Value in** ``exhale_args`` (str)
+    Doxygen writes ``combine.xslt`` next to ``index.xml``, running
+
+    .. code-block:: console
+
+       $ xsltproc combine.xslt index.xml > combined.xml
+
+    in the Doxygen XML output directory creates a document with every
+    ``<compounddef>``.  Set this to its path (relative paths are relative to the
+    Doxygen XML output directory, e.g. ``"combined.xml"``) and Exhale reads it from
+    start to end once, instead of opening a file per compound.  This is much faster on
+    network or overlay file systems where opening many small files dominates.  Only
+    where each compound is in the file is kept, it is read back when it is parsed.
+
+    .. note::
+
+       Breathe still reads ``index.xml`` and the ``{refid}.xml`` documents for the
+       directives Exhale emits.  Enabling
+       :data:`~exhale.configs.nativeMemberRendering` removes most of those.
+'''
+
+nodeDataStore = "memory"
+'''
+**Optional**
+    Where Exhale keeps the bulky data of the nodes (program listings, includes, and
+    function signatures) while it parses and generates: ``"memory"`` (the default) or
+    ``"sqlite"``.
+
+**Value in** ``exhale_args`` (str)
+    With ``"sqlite"``, the program listings, the includes and included by of every file,
+    and the function parameters and templates are written to a temporary SQLite
+    database (see :mod:`exhale.storage`) and streamed back while each document is
+    generated.  The parsed Doxygen XML documents are also not kept between parsing
+    stages, every stage that needs a document parses it again.  This is slower, but the
+    memory of these no longer grows with the size of the source code.  The generated
+    documents are identical.
+
+    .. note::
+
+       Only this data moves out of memory.  The nodes and their parent / child
+       relationships (i.e., the graph) are still kept in memory, and the documents are
+       generated from it as usual, so memory is **not** bounded: it still grows with the
+       number of nodes.  The database is removed once the documents are generated (or,
+       with :data:`~exhale.configs.onDemandGeneration`, when the Sphinx build finishes).
+'''
+
+metricsFile = None
+'''
+**Optional**
+    Write what each phase of generating the API cost to this JSON file.
+
+**Value in** ``exhale_args`` (str)
+    The time, Doxygen XML files opened, bytes read, documents parsed, and pages written
+    are recorded for running Doxygen, every stage of
+    :func:`~exhale.graph.ExhaleRoot.parse`, every generator of
+    :func:`~exhale.graph.ExhaleRoot.generateFullAPI`, and the hierarchies.  They are
+    always available as ``app.exhale_root.metrics`` (see :mod:`exhale.metrics`), setting
+    this also writes them to the file, e.g., for continuous integration to track::
+
+        {
+          "project": "my_project",
+          "nodes": {"class": 12, "file": 8, ...},
+          "phases": [
+            {"name": "parse", "depth": 0, "seconds": 1.2, "files_opened": 21, ...},
+            {"name": "discoverAllNodes", "depth": 1, "seconds": 0.3, "nodes": 143, ...},
+            ...
+          ],
+          "counters": {"files_opened": 21, "bytes_read": 482133, ...}
+        }
+
+    As with :data:`~exhale.configs.containmentFolder`, relative paths are relative to
+    the directory ``conf.py`` is in.  With ``exhale_projects``, use ``{project}`` in the
+    path to write a file per project (see :data:`~exhale.configs.PROJECT_FILES`).
+
+    .. note::
+
+       With :data:`~exhale.configs.onDemandGeneration` the file is written before Sphinx
+       reads the node documents.  What rendering them costs is added to the
+       ``counters`` of ``app.exhale_root.metrics`` as they are read, except in
+       ``sphinx-build -j N`` read workers, which count into their own copy.
+'''
+
+compoundCostReport = 0
+'''
+**Optional**
+    Report the compounds (classes, files, namespaces, ...) that were the most expensive
+    to parse and generate.
+
+**Value in** ``exhale_args`` (int)
+    How many compounds to list for each cost, ``0`` (the default) disables the report.
+    The compounds are ranked by the time spent reading and parsing their Doxygen XML,
+    its size, the time spent generating their documents, and the size of the generated
+    documents (see :data:`~exhale.metrics.COMPOUND_COSTS`).  Each is listed with its
+    ``refid``, ``kind``, and the file it is defined in.
+
+    The report is printed at the end of the build (after the name of its project), and
+    included as ``"compounds"`` in :data:`~exhale.configs.metricsFile` when it is set.
+    Recording it only adds a couple of timer calls per compound, so it can be left on,
+    e.g., for nightly builds to find what made them slower.
+
+    .. note::
+
+       With :data:`~exhale.configs.onDemandGeneration`, documents are generated by
+       Sphinx after the report was made, only parsing is attributed.
+'''
+
+traceFile = None
+'''
+**Optional**
+    Write a timeline of running Doxygen, parsing, and generating to this file, in the
+    Chrome trace event format.
+
+**Value in** ``exhale_args`` (str)
+    Open the file with ``chrome://tracing`` or https://ui.perfetto.dev to see where the
+    time went and what overlapped.  There is a span for the Doxygen subprocess, every
+    phase recorded in :mod:`exhale.metrics` (every stage of
+    :func:`~exhale.graph.ExhaleRoot.parse` and every generator of
+    :func:`~exhale.graph.ExhaleRoot.generateFullAPI`), and every project.  With
+    ``exhale_projects``, every worker process of :func:`~exhale.deploy.explodeProjects`
+    is its own track, and the ``traceFile`` of the project generated in the Sphinx
+    process receives all of them (the ``traceFile`` of the other projects is not
+    written).
+
+    When this is not set, the spans are not recorded at all.  As with
+    :data:`~exhale.configs.containmentFolder`, relative paths are relative to the
+    directory ``conf.py`` is in.
+'''
+
+memoryProfileFile = None
+'''
+**Optional**
+    Profile the memory of parsing and generating, and write a summary to this file.
+
+**Value in** ``exhale_args`` (str)
+    Meant for finding out what makes a build run out of memory, e.g., the parsed Doxygen
+    XML, program listings, or the documents being generated.  While
+    :func:`~exhale.deploy.explode` runs, :mod:`python:tracemalloc` traces every
+    allocation.  At the end of every phase recorded in :mod:`exhale.metrics`, the
+    largest and current resident set size of the process, the peak and current traced
+    memory, and the source lines holding the most memory are recorded (see
+    :class:`~exhale.metrics.MemoryProfile`).  The summary lists them per phase::
+
+        Phase                           Peak RSS          RSS       Traced  Traced peak
+        parse                          212.4 MiB    208.1 MiB    141.9 MiB    150.3 MiB
+          discoverAllNodes              98.0 MiB     97.6 MiB     38.2 MiB     41.0 MiB
+          ...
+
+        Top allocation sites at the end of every phase:
+
+        parse
+               96.1 MiB  .../bs4/element.py:1221 (803124 blocks)
+          ...
+
+    The numbers are also in the phases of ``app.exhale_root.metrics`` and
+    :data:`~exhale.configs.metricsFile`.  Tracing allocations makes the build several
+    times slower, do not leave this on.  As with
+    :data:`~exhale.configs.containmentFolder`, relative paths are relative to the
+    directory ``conf.py`` is in.  With ``exhale_projects``, use ``{project}`` in the path
+    to write a file per project (see :data:`~exhale.configs.PROJECT_FILES`).
+'''
+
+PROJECT_FILES = ("verboseBuildFile", "metricsFile", "traceFile", "memoryProfileFile")
+'''
+The configurations naming a file written about the build.  Any ``{project}`` in them is
+replaced with the name of the project (the key of ``breathe_projects``), e.g.,
+``"_build/{project}-metrics.json"``, so that every project of ``exhale_projects`` writes
+its own.  Relative paths are relative to the directory ``conf.py`` is in.
+'''
+
 ########################################################################################
 ##                                                                                     #
 ## Utility variables.                                                                  #
@@ -1291,13 +1651,175 @@ applicable) is directed to ``/dev/null`` as capturing it can cause the ``subproc
 buffers to overflow.
 '''
 
+_breathe_project = None
+'''
+**Do not modify**.  The key of ``breathe_projects`` being documented, given to every
+Breathe directive Exhale generates as ``:project:``.  This is
+``breathe_default_project`` unless ``exhale_projects`` is used (see
+:class:`~exhale.configs.ProjectConfigs`).
+'''
+
+_link_name_prefix = ""
+'''
+**Do not modify**.  Prepended to every label Exhale generates, so that the labels of
+different ``exhale_projects`` do not collide.  Empty for ``breathe_default_project``,
+``"{project}_"`` for every other project.
+'''
+
+
+class ProjectConfigs(object):
+    '''
+    The values of the variables in this module for one project.
+
+    Exhale keeps its configuration in the globals of this module, so documenting more
+    than one project means swapping all of them.  In ``conf.py``, map the keys of
+    ``breathe_projects`` to the ``exhale_args`` of each project:
+
+    .. code-block:: py
+
+       breathe_projects = {"core": "./_doxygen/core/xml", "io": "./_doxygen/io/xml"}
+       breathe_default_project = "core"
+       exhale_args = {
+           # Shared by every project, each project may override them.
+           "doxygenStripFromPath": "..",
+           "exhaleExecutesDoxygen": True
+       }
+       exhale_projects = {
+           "core": {"containmentFolder": "./api/core", "rootFileName": "core_root.rst",
+                    "exhaleDoxygenStdin": "INPUT = ../core/include"},
+           "io":   {"containmentFolder": "./api/io", "rootFileName": "io_root.rst",
+                    "exhaleDoxygenStdin": "INPUT = ../io/include"}
+       }
+
+    Every project needs its own ``containmentFolder``.  The projects are generated
+    concurrently by :func:`~exhale.deploy.explodeProjects`.  Labels keep their usual
+    names for ``breathe_default_project``, the labels of every other project are
+    prefixed with ``{project}_`` (e.g., ``io_exhale_class_classfoo``), so the generated
+    trees can link to each other with ``:ref:``.  An ``#include`` of a file or a base
+    class another project documents links to its document there, see
+    :func:`~exhale.graph.ExhaleRoot.projectLink`.
+
+    The values are read as attributes (``project_configs.containmentFolder``), each
+    :class:`~exhale.graph.ExhaleRoot` is given the object of its project and reads its
+    configuration from it, rather than from the variables of this module.
+
+    **Parameters**
+        ``project`` (str or ``None``)
+            The key of ``breathe_projects`` the values belong to, ``None`` for the
+            defaults.
+
+    **Attributes**
+        ``values`` (:class:`python:dict`)
+            The variable names and their values when this object was created.
+    '''
+    def __init__(self, project):
+        self.project = project
+        self.values  = {}
+        configs_globals = globals()
+        for key in configs_globals:
+            val = configs_globals[key]
+            if key.startswith("__") or key in ("logger", "_default_configs"):
+                continue
+            if isinstance(val, (FunctionType, ModuleType, type)):
+                continue
+            self.values[key] = self._copy(val)
+
+    @staticmethod
+    def _copy(val):
+        # Containers are copied so that the projects do not share mutable state.
+        if isinstance(val, (list, dict, set)):
+            return type(val)(val)
+        return val
+
+    def __getattr__(self, name):
+        # Only called for names that are not attributes of this object.  Unpickling
+        # looks up methods before ``values`` is restored.
+        values = self.__dict__.get("values", None)
+        if values is None or name not in values:
+            raise AttributeError(name)
+        return values[name]
+
+    def activate(self):
+        '''
+        Set the variables of this module to the stored values.
+        '''
+        configs_globals = globals()
+        for key in self.values:
+            configs_globals[key] = self._copy(self.values[key])
+
+    def __getstate__(self):
+        # Sent to the worker processes of deploy.explodeProjects, which cannot be given
+        # the Sphinx application (they are given a deploy._WorkerApp instead).
+        state = dict(self.__dict__)
+        state["values"] = dict(self.values)
+        state["values"]["_the_app"] = None
+        return state
+
+
+_FINGERPRINT_IGNORED = frozenset([
+    # Logging and profiling.
+    "verboseBuild", "verboseBuildFile", "alwaysColorize", "metricsFile", "compoundCostReport",
+    "traceFile", "memoryProfileFile",
+    # How the Doxygen XML is produced and read, its contents are fingerprinted instead.
+    "exhaleExecutesDoxygen", "exhaleUseDoxyfile", "exhaleDoxygenStdin", "exhaleDoxygenLean",
+    "exhaleSilentDoxygen", "doxygenCombinedXML",
+    # Where (not what) Exhale stores.
+    "contentStoreDirectory", "nodeDataStore", "onDemandGeneration"
+])
+
+
+def _stable_repr(val):
+    # A repr that is the same in every process, e.g., no memory addresses.
+    if isinstance(val, dict):
+        return "{" + ", ".join(sorted(
+            "{0}: {1}".format(_stable_repr(k), _stable_repr(v)) for k, v in val.items()
+        )) + "}"
+    if isinstance(val, (set, frozenset)):
+        return "{" + ", ".join(sorted(_stable_repr(v) for v in val)) + "}"
+    if isinstance(val, (list, tuple)):
+        return "[" + ", ".join(_stable_repr(v) for v in val) + "]"
+    if hasattr(val, "pattern") and hasattr(val, "flags"):  # a compiled regular expression
+        return "re({0!r}, {1})".format(val.pattern, val.flags)
+    if callable(val):
+        return "{0}.{1}".format(getattr(val, "__module__", ""), getattr(val, "__qualname__", ""))
+    return repr(val)
+
+
+def generationFingerprint(project_configs=None):
+    '''
+    **Parameters**
+        ``project_configs`` (:class:`~exhale.configs.ProjectConfigs` or ``None``)
+            The configuration to fingerprint, ``None`` for the variables of this module.
+
+    **Return**
+        ``str``
+            The ``sha1`` of the Exhale version and the value of every variable in this
+            module that changes the generated documents.  Logging and profiling options,
+            and how the Doxygen XML is produced or read, are not part of it.  See
+            :func:`~exhale.graph.ExhaleRoot.deferNodeDocuments`.
+    '''
+    from . import __version__
+
+    sha1 = hashlib.sha1(__version__.encode("utf-8"))
+    configs_globals = globals() if project_configs is None else project_configs.values
+    for key in sorted(configs_globals):
+        val = configs_globals[key]
+        if key.startswith("_") and key not in ("_breathe_project", "_link_name_prefix"):
+            continue
+        if key == "logger" or key in _FINGERPRINT_IGNORED:
+            continue
+        if isinstance(val, (FunctionType, ModuleType, type)):
+            continue
+        sha1.update("{0}={1}\n".format(key, _stable_repr(val)).encode("utf-8"))
+    return sha1.hexdigest()
+
 ########################################################################################
 ##                                                                                     #
 ## Secondary Sphinx Entry Point                                                        #
 ## Called from exhale/__init__.py:environment_ready during the sphinx build process.   #
 ##                                                                                     #
 ########################################################################################
-def apply_sphinx_configurations(app):
+def apply_sphinx_configurations(app, project=None, run_doxygen=True):
     '''
     This method applies the various configurations users place in their ``conf.py``, in
     the dictionary ``exhale_args``.  The error checking seems to be robust, and
@@ -1316,9 +1838,18 @@ def apply_sphinx_configurations(app):
     **Parameters**
         ``app`` (:class:`sphinx.application.Sphinx`)
             The Sphinx Application running the documentation build.
+
+        ``project`` (str or ``None``)
+            The key of ``exhale_projects`` to configure (see
+            :class:`~exhale.configs.ProjectConfigs`), ``None`` for the
+            ``breathe_default_project`` configured by ``exhale_args`` alone.
+
+        ``run_doxygen`` (bool)
+            Whether to call :func:`~exhale.configs.prepare_doxygen_xml` before
+            returning.  :func:`~exhale.deploy.explodeProjects` defers this so that
+            Doxygen runs concurrently for every project.
     '''
     # Import local to function to prevent circular imports elsewhere in the framework.
-    from . import deploy
     from . import utils
     ####################################################################################
     # Make sure they have the `breathe` configs setup in a way that we can use them.   #
@@ -1347,13 +1878,29 @@ def apply_sphinx_configurations(app):
             )
         )
 
+    if project is None:
+        project = breathe_default_project
+        # A new build, explodeProjects resets the log once for all of its projects.
+        utils.resetVerboseLog()
+    elif project not in breathe_projects:
+        raise ConfigError(
+            "The `exhale_projects` key '{0}' was not a valid key in `breathe_projects`:\n{1}".format(
+                project, breathe_projects
+            )
+        )
+
+    global _breathe_project
+    global _link_name_prefix
+    _breathe_project = project
+    _link_name_prefix = "" if project == breathe_default_project else "{0}_".format(project)
+
     # Grab where the Doxygen xml output is supposed to go, make sure it is a string,
     # defer validation of existence until after potentially running Doxygen based on
     # the configs given to exhale
-    doxy_xml_dir = breathe_projects[breathe_default_project]
+    doxy_xml_dir = breathe_projects[project]
     if not isinstance(doxy_xml_dir, six.string_types):
         raise ConfigError(
-            "The type of `breathe_projects[breathe_default_project]` from `conf.py` was not a string."
+            "The type of `breathe_projects['{0}']` from `conf.py` was not a string.".format(project)
         )
 
     # Make doxy_xml_dir relative to confdir (where conf.py is)
@@ -1369,6 +1916,15 @@ def apply_sphinx_configurations(app):
     elif type(exhale_args) is not dict:
         raise ConfigError("The type of `exhale_args` in `conf.py` must be a dictionary.")
 
+    # The arguments of a project in `exhale_projects` override the shared `exhale_args`.
+    exhale_projects = getattr(app.config, "exhale_projects", None) or {}
+    if type(exhale_projects) is not dict:
+        raise ConfigError("The type of `exhale_projects` in `conf.py` must be a dictionary.")
+    if project in exhale_projects:
+        if type(exhale_projects[project]) is not dict:
+            raise ConfigError("The type of `exhale_projects['{0}']` must be a dictionary.".format(project))
+        exhale_args = dict(exhale_args, **exhale_projects[project])
+
     ####################################################################################
     # In order to be able to loop through things below, we want to grab the globals    #
     # dictionary (rather than needing to do `global containmentFolder` etc for every   #
@@ -1475,6 +2031,7 @@ def apply_sphinx_configurations(app):
         ("rootFileTitle",                   six.string_types),
         # Build Process Logging, Colors, and Debugging
         ("verboseBuild",                                bool),
+        ("verboseBuildFile",                six.string_types),
         ("alwaysColorize",                              bool),
         ("generateBreatheFileDirectives",               bool),
         # Root API Document Customization and Treeview
@@ -1485,6 +2042,7 @@ def apply_sphinx_configurations(app):
         ("afterBodySummary",                six.string_types),
         ("fullToctreeMaxDepth",                          int),
         ("listingExclude",                              list),
+        ("listingExcludeDoxygen",                       bool),
         ("unabridgedOrphanKinds",                (list, set)),
         # Manual Indexing
         ("classHierarchyFilename",          six.string_types),
@@ -1517,9 +2075,20 @@ def apply_sphinx_configurations(app):
         ("exhaleExecutesDoxygen",                       bool),
         ("exhaleUseDoxyfile",                           bool),
         ("exhaleDoxygenStdin",              six.string_types),
+        ("exhaleDoxygenLean",                           bool),
         ("exhaleSilentDoxygen",                         bool),
         # Programlisting Customization
-        ("lexerMapping",                                 dict)
+        ("lexerMapping",                                 dict),
+        # Build Performance
+        ("onDemandGeneration",                          bool),
+        ("nativeMemberRendering",                       bool),
+        ("contentStoreDirectory",                       six.string_types),
+        ("doxygenCombinedXML",                          six.string_types),
+        ("nodeDataStore",                               six.string_types),
+        ("metricsFile",                                 six.string_types),
+        ("compoundCostReport",                          int),
+        ("traceFile",                                   six.string_types),
+        ("memoryProfileFile",                           six.string_types)
     ]
     for key, expected_type in opt_kv:
         # Used in error checking later
@@ -1543,6 +2112,32 @@ def apply_sphinx_configurations(app):
                     )
                 )
 
+    # Shared between builds, so relative to conf.py rather than containmentFolder.
+    if contentStoreDirectory and not os.path.isabs(contentStoreDirectory):
+        configs_globals["contentStoreDirectory"] = os.path.abspath(
+            os.path.join(os.path.abspath(app.confdir), contentStoreDirectory)
+        )
+    # The files written about the build, "{project}" is replaced with the project so
+    # that every project of exhale_projects can have its own (see PROJECT_FILES).
+    for key in PROJECT_FILES:
+        path = configs_globals[key]
+        if path:
+            configs_globals[key] = os.path.abspath(
+                os.path.join(os.path.abspath(app.confdir), path.replace("{project}", _breathe_project))
+            )
+
+    if compoundCostReport < 0:
+        raise ConfigError("`compoundCostReport` must be 0 (disabled) or positive, not {0}.".format(
+            compoundCostReport
+        ))
+
+    if nodeDataStore not in ("memory", "sqlite"):
+        raise ConfigError(
+            "`nodeDataStore` must be either \"memory\" or \"sqlite\", not \"{0}\".".format(
+                nodeDataStore
+            )
+        )
+
     # These two need to be lists of strings, check to make sure
     def _list_of_strings(lst, title):
         for spec in lst:
@@ -1777,69 +2372,11 @@ def apply_sphinx_configurations(app):
     global _doxygen_xml_output_directory
     _doxygen_xml_output_directory = doxy_xml_dir
 
-    # If requested, the time is nigh for executing doxygen.  The strategy:
-    # 1. Execute doxygen if requested
-    # 2. Verify that the expected doxy_xml_dir (specified to `breathe`) was created
-    # 3. Assuming everything went to plan, let exhale take over and create all of the .rst docs
-    if exhaleExecutesDoxygen:
-        # Cannot use both, only one or the other
-        if exhaleUseDoxyfile and (exhaleDoxygenStdin is not None):
-            raise ConfigError("You must choose one of `exhaleUseDoxyfile` or `exhaleDoxygenStdin`, not both.")
-
-        # The Doxyfile *must* be at the same level as conf.py
-        # This is done so that when separate source / build directories are being used,
-        # we can guarantee where the Doxyfile is.
-        if exhaleUseDoxyfile:
-            doxyfile_path = os.path.abspath(os.path.join(app.confdir, "Doxyfile"))
-            if not os.path.exists(doxyfile_path):
-                raise ConfigError("The file [{0}] does not exist".format(doxyfile_path))
-
-        here = os.path.abspath(os.curdir)
-        if here == app.confdir:
-            returnPath = None
-        else:
-            returnPath = here
-
-        # All necessary information ready, go to where the Doxyfile is, run Doxygen
-        # and then return back (where applicable) so sphinx can continue
-        start = utils.get_time()
-        if returnPath:
-            logger.info(utils.info(
-                "Exhale: changing directories to [{0}] to execute Doxygen.".format(app.confdir)
-            ))
-            os.chdir(app.confdir)
-        logger.info(utils.info("Exhale: executing doxygen."))
-        status = deploy.generateDoxygenXML()
-        # Being overly-careful to put sphinx back where it was before potentially erroring out
-        if returnPath:
-            logger.info(utils.info(
-                "Exhale: changing directories back to [{0}] after Doxygen.".format(returnPath)
-            ))
-            os.chdir(returnPath)
-        if status:
-            raise ExtensionError(status)
-        else:
-            end = utils.get_time()
-            logger.info(utils.progress(
-                "Exhale: doxygen ran successfully in {0}.".format(utils.time_string(start, end))
-            ))
-    else:
-        if exhaleUseDoxyfile:
-            logger.warning("Exhale: `exhaleUseDoxyfile` ignored since `exhaleExecutesDoxygen=False`")
-        if exhaleDoxygenStdin is not None:
-            logger.warning("Exhale: `exhaleDoxygenStdin` ignored since `exhaleExecutesDoxygen=False`")
-        if exhaleSilentDoxygen:
-            logger.warning("Exhale: `exhaleSilentDoxygen=True` ignored since `exhaleExecutesDoxygen=False`")
-
-    # Either Doxygen was run prior to this being called, or we just finished running it.
-    # Make sure that the files we need are actually there.
-    if not os.path.isdir(doxy_xml_dir):
-        raise ConfigError(
-            "Exhale: the specified folder [{0}] does not exist.  Has Doxygen been run?".format(doxy_xml_dir)
-        )
-    index = os.path.join(doxy_xml_dir, "index.xml")
-    if not os.path.isfile(index):
-        raise ConfigError("Exhale: the file [{0}] does not exist.  Has Doxygen been run?".format(index))
+    if run_doxygen:
+        if traceFile:
+            from . import metrics
+            metrics.startTrace()
+        prepare_doxygen_xml(app)
 
     # Legacy / debugging feature, warn of its purpose
     if generateBreatheFileDirectives:
@@ -1931,3 +2468,121 @@ def apply_sphinx_configurations(app):
                 app.add_js_file(js)
 
         logger.info(utils.progress("Exhale: added tree view css / javascript."))
+
+
+def prepare_doxygen_xml(app):
+    '''
+    Run Doxygen when :data:`~exhale.configs.exhaleExecutesDoxygen` is ``True``, then make
+    sure the Doxygen XML Exhale will read exists.  Called at the end of
+    :func:`~exhale.configs.apply_sphinx_configurations` unless told otherwise.
+
+    **Parameters**
+        ``app`` (:class:`sphinx.application.Sphinx`)
+            The Sphinx Application running the documentation build.
+    '''
+    # Import local to function to prevent circular imports elsewhere in the framework.
+    from . import deploy
+    from . import metrics
+    from . import utils
+
+    doxy_xml_dir = _doxygen_xml_output_directory
+    # If requested, the time is nigh for executing doxygen.  The strategy:
+    # 1. Execute doxygen if requested
+    # 2. Verify that the expected doxygen xml directory (specified to `breathe`) was created
+    # 3. Assuming everything went to plan, let exhale take over and create all of the .rst docs
+    if exhaleExecutesDoxygen:
+        # Cannot use both, only one or the other
+        if exhaleUseDoxyfile and (exhaleDoxygenStdin is not None):
+            raise ConfigError("You must choose one of `exhaleUseDoxyfile` or `exhaleDoxygenStdin`, not both.")
+
+        # The Doxyfile *must* be at the same level as conf.py
+        # This is done so that when separate source / build directories are being used,
+        # we can guarantee where the Doxyfile is.
+        if exhaleUseDoxyfile:
+            doxyfile_path = os.path.abspath(os.path.join(app.confdir, "Doxyfile"))
+            if not os.path.exists(doxyfile_path):
+                raise ConfigError("The file [{0}] does not exist".format(doxyfile_path))
+
+        here = os.path.abspath(os.curdir)
+        if here == app.confdir:
+            returnPath = None
+        else:
+            returnPath = here
+
+        # All necessary information ready, go to where the Doxyfile is, run Doxygen
+        # and then return back (where applicable) so sphinx can continue
+        start = utils.get_time()
+        if returnPath:
+            logger.info(utils.info(
+                "Exhale: changing directories to [{0}] to execute Doxygen.".format(app.confdir)
+            ))
+            os.chdir(app.confdir)
+        logger.info(utils.info("Exhale: executing doxygen."))
+        with metrics.current().phase("doxygen"):
+            status = deploy.generateDoxygenXML()
+        # Being overly-careful to put sphinx back where it was before potentially erroring out
+        if returnPath:
+            logger.info(utils.info(
+                "Exhale: changing directories back to [{0}] after Doxygen.".format(returnPath)
+            ))
+            os.chdir(returnPath)
+        if status:
+            raise ExtensionError(status)
+        else:
+            end = utils.get_time()
+            logger.info(utils.progress(
+                "Exhale: doxygen ran successfully in {0}.".format(utils.time_string(start, end))
+            ))
+    else:
+        if exhaleUseDoxyfile:
+            logger.warning("Exhale: `exhaleUseDoxyfile` ignored since `exhaleExecutesDoxygen=False`")
+        if exhaleDoxygenStdin is not None:
+            logger.warning("Exhale: `exhaleDoxygenStdin` ignored since `exhaleExecutesDoxygen=False`")
+        if exhaleSilentDoxygen:
+            logger.warning("Exhale: `exhaleSilentDoxygen=True` ignored since `exhaleExecutesDoxygen=False`")
+
+    # Either Doxygen was run prior to this being called, or we just finished running it.
+    # Whatever was found in the output before may be stale now (Doxygen may write to
+    # CREATE_SUBDIRS directories without modifying the output directory).
+    utils.forgetDoxygenXML()
+
+    # Make sure that the files we need are actually there.
+    if utils.isDoxygenXMLArchive(doxy_xml_dir):
+        if "breathe" in getattr(app, "extensions", {}):
+            logger.warning(
+                "Exhale: reading the Doxygen XML archive [{0}], but Breathe cannot.".format(doxy_xml_dir)
+            )
+    elif not os.path.isdir(doxy_xml_dir):
+        raise ConfigError(
+            "Exhale: the specified folder [{0}] does not exist.  Has Doxygen been run?".format(doxy_xml_dir)
+        )
+    global doxygenCombinedXML
+    if doxygenCombinedXML:
+        if not os.path.isabs(doxygenCombinedXML):
+            doxygenCombinedXML = os.path.abspath(os.path.join(doxy_xml_dir, doxygenCombinedXML))
+        if not os.path.isfile(doxygenCombinedXML):
+            raise ConfigError("Exhale: the `doxygenCombinedXML` file [{0}] does not exist.".format(
+                doxygenCombinedXML
+            ))
+    elif not utils.hasDoxygenXML("index.xml"):
+        index = os.path.join(doxy_xml_dir, "index.xml")
+        raise ConfigError("Exhale: the file [{0}] does not exist.  Has Doxygen been run?".format(index))
+
+    # Breathe only reads `{refid}.xml` next to `index.xml`, it cannot find the documents of
+    # a `CREATE_SUBDIRS = YES` output (only the standalone `exhale` command can).
+    if "breathe" in getattr(app, "extensions", {}) and not utils.isDoxygenXMLArchive(doxy_xml_dir):
+        nested = sorted(name for name in utils.doxygenXMLDocuments().values() if "/" in name)
+        if nested:
+            raise ConfigError(
+                "Exhale: the Doxygen XML output [{0}] has documents in sub-directories (e.g. [{1}]), "
+                "which Breathe cannot read.  Set `CREATE_SUBDIRS = NO` for Sphinx builds.".format(
+                    doxy_xml_dir, nested[0]
+                )
+            )
+
+
+_default_configs = ProjectConfigs(None)
+'''
+**Do not modify**.  The default value of every variable, restored by
+:func:`~exhale.deploy.explodeProjects` before configuring each project.
+'''
@@ -10,12 +10,14 @@
 The deploy module is responsible for two primary actions:
 
 1. Executing Doxygen (if requested in ``exhale_args``).
-2. Launching the full API generation via the :func:`~exhale.deploy.explode` function.
+2. Launching the full API generation via the :func:`~exhale.deploy.explode` function,
+   or :func:`~exhale.deploy.explodeProjects` for every project in ``exhale_projects``.
 '''
 
 from __future__ import unicode_literals
 
 from . import configs
+from . import metrics
 from . import utils
 from .graph import ExhaleRoot
 
@@ -24,9 +26,191 @@ import sys
 import six
 import re
 import codecs
-import tempfile
+import logging
+import multiprocessing
 import textwrap
-from subprocess import PIPE, Popen, STDOUT
+import threading
+import time
+from concurrent.futures import ProcessPoolExecutor
+from subprocess import PIPE, Popen
+from types import SimpleNamespace
+
+from sphinx.util.logging import getLogger
+
+logger = getLogger(__name__)
+
+_DOXYGEN_PHASE_REGEX = re.compile(
+    r"^(?!(?:Preprocessing|Parsing file|Reading|Generating (?:code|docs|XML output|dependency graph|"
+    r"include graph|call graph|caller graph|diagram|directory dependency graph) for) )"
+    r"(?:[A-Z][\w ,()'/-]*\.\.\.|Parsing files|finished\.\.\.)$"
+)
+_DOXYGEN_WARNING_REGEX = re.compile(r"\b(warning|error): (.*)$")
+# Doxygen quotes names as 'name', "name", or `name' (older versions).
+_DOXYGEN_QUOTED_REGEX = re.compile(r"'[^']*'|\"[^\"]*\"|`[^`']*[`']|\b\d+\b")
+
+
+class DoxygenOutput(object):
+    '''
+    Follows the output of the Doxygen subprocess line by line while it runs, see
+    :func:`~exhale.deploy._generate_doxygen`.
+
+    Doxygen announces each of its phases on ``stdout`` (e.g. ``Parsing files`` or
+    ``Building class list...``), a phase lasts until the next one is announced.  The
+    warnings and errors on ``stderr`` are counted by category (the message with quoted
+    names and numbers removed).  Nothing else is kept, so memory stays bounded no matter
+    how verbose Doxygen is.
+
+    **Parameters**
+        ``echo`` (bool)
+            Whether every line is logged (``stderr`` lines with a yellow ``[~]`` prefix)
+            as it arrives.  Doxygen's warnings are counted and summarized rather than
+            logged as Sphinx warnings.
+
+        ``progress`` (bool)
+            Whether the phases are logged as they start when ``echo`` is ``False``.
+
+        ``max_categories`` (int)
+            How many warning categories are counted, the rest are counted as ``other``.
+
+        ``max_examples`` (int)
+            How many warnings are kept verbatim for the summary.
+
+    **Attributes**
+        ``phases`` (list)
+            The ``(name, start, end)`` of every phase that ended, the times are
+            :func:`python:time.perf_counter` values.
+
+        ``warnings`` (int)
+            How many warnings and errors were reported.
+
+        ``categories`` (dict)
+            How many warnings of every category were reported.
+
+        ``examples`` (list)
+            The first ``max_examples`` warnings.
+    '''
+    def __init__(self, echo=True, progress=True, max_categories=50, max_examples=10):
+        self.echo           = echo
+        self.progress       = progress
+        self.max_categories = max_categories
+        self.max_examples   = max_examples
+        self.phases         = []
+        self.warnings       = 0
+        self.categories     = {}
+        self.examples       = []
+        self.start          = time.perf_counter()
+        self.end            = None
+        self._phase         = None
+        self._phase_start   = None
+        self._err_prefix    = utils._use_color(
+            utils.prefix("[~]", " "), utils.AnsiColors.BOLD_YELLOW, sys.stdout
+        )
+
+    def _endPhase(self, now):
+        if self._phase is not None:
+            self.phases.append((self._phase, self._phase_start, now))
+            self._phase = None
+
+    def stdoutLine(self, line, now=None):
+        '''
+        Handle one line Doxygen wrote to ``stdout``.
+
+        **Parameters**
+            ``line`` (str)
+                The line, with or without its newline.
+
+            ``now`` (float or ``None``)
+                When it was written, :func:`python:time.perf_counter` when ``None``.
+        '''
+        if self.echo:
+            logger.info(line.rstrip("\n"))
+        stripped = line.strip()
+        if not _DOXYGEN_PHASE_REGEX.match(stripped):
+            return
+        now = time.perf_counter() if now is None else now
+        self._endPhase(now)
+        # "finished..." is the end of the last phase, not a phase of its own.
+        if stripped != "finished...":
+            self._phase       = stripped.rstrip(".")
+            self._phase_start = now
+        if self.progress and not self.echo:
+            logger.info("Doxygen: {0}".format(stripped))
+
+    def stderrLine(self, line):
+        '''
+        Handle one line Doxygen wrote to ``stderr``.
+
+        **Parameters**
+            ``line`` (str)
+                The line, with or without its newline.
+        '''
+        if self.echo:
+            logger.info(self._err_prefix + line.rstrip("\n"))
+        match = _DOXYGEN_WARNING_REGEX.search(line.rstrip())
+        if not match:
+            return
+        self.warnings += 1
+        metrics.count("doxygen_warnings")
+        category = "{0}: {1}".format(match.group(1), _DOXYGEN_QUOTED_REGEX.sub("...", match.group(2)))
+        if category not in self.categories and len(self.categories) >= self.max_categories:
+            category = "other"
+        self.categories[category] = self.categories.get(category, 0) + 1
+        if len(self.examples) < self.max_examples:
+            self.examples.append(line.strip())
+
+    def finish(self, now=None):
+        '''
+        End the phase that is running when Doxygen exits.
+
+        **Parameters**
+            ``now`` (float or ``None``)
+                When Doxygen exited, :func:`python:time.perf_counter` when ``None``.
+        '''
+        self.end = time.perf_counter() if now is None else now
+        self._endPhase(self.end)
+
+    def summary(self, top=5):
+        '''
+        **Parameters**
+            ``top`` (int)
+                How many of the slowest phases and most common warnings are listed.
+
+        **Return**
+            str
+                The total time, the ``top`` slowest phases, and how many warnings (of
+                the ``top`` most common categories) were reported.
+        '''
+        end = time.perf_counter() if self.end is None else self.end
+        lines = ["Doxygen finished in {0:.2f}s.".format(end - self.start)]
+        slowest = sorted(self.phases, key=lambda p: p[2] - p[1], reverse=True)[:top]
+        if slowest:
+            lines.append("  Slowest phases:")
+            for name, start, end in slowest:
+                lines.append("    {0:>9.2f}s  {1}".format(end - start, name))
+        if self.warnings:
+            lines.append("  {0} warning(s), most common:".format(self.warnings))
+            common = sorted(self.categories.items(), key=lambda c: (-c[1], c[0]))[:top]
+            for category, count in common:
+                lines.append("    {0:>10}  {1}".format(count, category))
+        return "\n".join(lines)
+
+
+def _feed_doxygen(stream, doxygen_input):
+    # Writes stdin while stdout is being read, so neither pipe can fill up.
+    try:
+        stream.write(doxygen_input)
+    except (BrokenPipeError, OSError):  # Doxygen exited early, its exit code says why
+        pass
+    finally:
+        try:
+            stream.close()
+        except (BrokenPipeError, OSError):
+            pass
+
+
+def _pump_lines(stream, handle):
+    for line in stream:
+        handle(line)
 
 
 def _generate_doxygen(doxygen_input):
@@ -34,10 +218,10 @@ def _generate_doxygen(doxygen_input):
     This method executes doxygen based off of the specified input.  By the time this
     method is executed, it is assumed that Doxygen is intended to be run in the
     **current working directory**.  Search for ``returnPath`` in the implementation of
-    :func:`~exhale.configs.apply_sphinx_configurations` for handling of this aspect.
+    :func:`~exhale.configs.prepare_doxygen_xml` for handling of this aspect.
 
     This method is intended to be called by :func:`~exhale.deploy.generateDoxygenXML`,
-    which is in turn called by :func:`~exhale.configs.apply_sphinx_configurations`.
+    which is in turn called by :func:`~exhale.configs.prepare_doxygen_xml`.
 
     Two versions of the
     doxygen command can be executed:
@@ -48,6 +232,11 @@ def _generate_doxygen(doxygen_input):
     2. For all other values, ``doxygen_input`` represents the arguments as to be
        specified on ``stdin`` to the process.
 
+    The output of Doxygen is printed as it arrives, and every phase Doxygen announces
+    is recorded on the current :class:`~exhale.metrics.BuildMetrics` (e.g. the phase
+    ``"doxygen: Building class list"``), see :class:`~exhale.deploy.DoxygenOutput`.
+    A summary of the slowest phases and the warnings is printed when it exits.
+
     **Parameters**
         ``doxygen_input`` (str)
             Either the string ``"Doxyfile"`` to run vanilla ``doxygen``, or the
@@ -56,13 +245,8 @@ def _generate_doxygen(doxygen_input):
 
             .. note::
 
-               If using Python **3**, the input **must** still be a ``str``.  This
-               method will convert the input to ``bytes`` as follows:
-
-               .. code-block:: py
-
-                  if sys.version[0] == "3":
-                      doxygen_input = bytes(doxygen_input, "utf-8")
+               The input **must** be a ``str``, it is written to ``stdin`` encoded as
+               ``utf-8`` while the output of Doxygen is being read.
 
     **Return**
         ``str`` or ``None``
@@ -93,78 +277,43 @@ def _generate_doxygen(doxygen_input):
             args   = ["doxygen", "-"]
             kwargs = {"stdin": PIPE}
 
-        if configs._on_rtd:
-            # On RTD, any capturing of Doxygen output can cause buffer overflows for
-            # even medium sized projects.  So it is disregarded entirely to ensure the
-            # build will complete (otherwise, it silently fails after `cat conf.py`)
-            devnull_file     = open(os.devnull, "w")
-            kwargs["stdout"] = devnull_file
-            kwargs["stderr"] = STDOUT
-        else:
-            # TL;DR: strictly enforce that (verbose) doxygen output doesn't cause the
-            # `communicate` to hang due to buffer overflows.
-            #
-            # See excellent synopsis:
-            # https://thraxil.org/users/anders/posts/2008/03/13/Subprocess-Hanging-PIPE-is-your-enemy/
-            if six.PY2:
-                tempfile_kwargs = {}
-            else:
-                # encoding argument introduced in python 3
-                tempfile_kwargs = {"encoding": "utf-8"}
-            tempfile_kwargs["mode"] = "r+"
-            tmp_out_file = tempfile.TemporaryFile(
-                prefix="doxygen_stdout_buff", **tempfile_kwargs
-            )
-            tmp_err_file = tempfile.TemporaryFile(
-                prefix="doxygen_stderr_buff", **tempfile_kwargs
-            )
-
-            # Write to the tempfiles over PIPE to avoid buffer overflowing
-            kwargs["stdout"] = tmp_out_file
-            kwargs["stderr"] = tmp_err_file
-
-        # Note: overload of args / kwargs, Popen is expecting a list as the first
-        #       parameter (aka no *args, just args)!
-        doxygen_proc = Popen(args, **kwargs)
-
-        # Communicate can only be called once, arrange whether or not stdin has value
-        if not doxyfile:
-            # In Py3, make sure we are communicating a bytes-like object which is no
-            # longer interchangeable with strings (as was the case in Py2).
-            if sys.version[0] == "3":
-                doxygen_input = bytes(doxygen_input, "utf-8")
-            comm_kwargs = {"input": doxygen_input}
-        else:
-            comm_kwargs = {}
-
-        # Waits until doxygen has completed
-        doxygen_proc.communicate(**comm_kwargs)
-
-        # Print out what was written to the tmpfiles by doxygen
-        if not configs._on_rtd and not configs.exhaleSilentDoxygen:
-            # Doxygen output (some useful information, mostly just enumeration of the
-            # configurations you gave it {useful for debugging...})
-            if tmp_out_file.tell() > 0:
-                tmp_out_file.seek(0)
-                print(tmp_out_file.read())
-            # Doxygen error (e.g. any warnings, or invalid input)
-            if tmp_err_file.tell() > 0:
-                # Making them stick out, ideally users would reduce this output to 0 ;)
-                # This will print a yellow [~] before every line, but not make the
-                # entire line yellow because it's definitively not helpful
-                prefix = utils._use_color(
-                    utils.prefix("[~]", " "), utils.AnsiColors.BOLD_YELLOW, sys.stderr
-                )
-                tmp_err_file.seek(0)
-                sys.stderr.write(utils.prefix(prefix, tmp_err_file.read()))
-
-        # Close the file handles opened for communication with subprocess
-        if configs._on_rtd:
-            devnull_file.close()
-        else:
-            # Delete the tmpfiles
-            tmp_out_file.close()
-            tmp_err_file.close()
+        # Both streams are read line by line while Doxygen runs (stderr on its own
+        # thread), so neither pipe can fill up and hang the process, and nothing is
+        # buffered beyond the line being handled.  On RTD, where echoing all of the
+        # output has overflowed the build log, only the phases and summary are printed.
+        kwargs.update(stdout=PIPE, stderr=PIPE, universal_newlines=True, bufsize=1,
+                      encoding="utf-8", errors="replace")
+        output = DoxygenOutput(
+            echo=not configs._on_rtd and not configs.exhaleSilentDoxygen,
+            progress=not configs.exhaleSilentDoxygen
+        )
+
+        with metrics.span("doxygen subprocess", "subprocess"):
+            # Note: overload of args / kwargs, Popen is expecting a list as the first
+            #       parameter (aka no *args, just args)!
+            doxygen_proc = Popen(args, **kwargs)
+            threads = [threading.Thread(target=_pump_lines, args=(doxygen_proc.stderr, output.stderrLine))]
+            if not doxyfile:
+                threads.append(threading.Thread(
+                    target=_feed_doxygen, args=(doxygen_proc.stdin, doxygen_input)
+                ))
+            for thread in threads:
+                thread.daemon = True
+                thread.start()
+
+            _pump_lines(doxygen_proc.stdout, output.stdoutLine)
+            for thread in threads:
+                thread.join()
+            doxygen_proc.wait()
+            output.finish()
+            doxygen_proc.stdout.close()
+            doxygen_proc.stderr.close()
+
+        build_metrics = metrics.current()
+        for name, start, end in output.phases:
+            build_metrics.record("doxygen: {0}".format(name), start, end)
+        if not configs.exhaleSilentDoxygen:
+            logger.info(output.summary())
 
         # Make sure we had a valid execution of doxygen
         exit_code = doxygen_proc.returncode
@@ -295,7 +444,7 @@ def generateDoxygenXML():
         for cfg in ("ALIASES", "PREDEFINED"):
             found = re.search(re_template.format(config=cfg), configs.exhaleDoxygenStdin)
             if found:
-                sys.stderr.write(utils.info(textwrap.dedent('''
+                logger.warning(utils.info(textwrap.dedent('''
                     You have supplied to `exhaleDoxygenStdin` a configuration of:
 
                         {cfg}   =   {theirs}
@@ -311,7 +460,8 @@ def generateDoxygenXML():
 
                            {cfg}   +=   {theirs}
 
-                '''.format(cfg=cfg, theirs=found.groups()[0])), utils.AnsiColors.BOLD_YELLOW))
+                '''.format(cfg=cfg, theirs=found.groups()[0])), utils.AnsiColors.BOLD_YELLOW),
+                    type="exhale", subtype="doxygen_stdin")
 
         # Include their custom doxygen definitions after the defaults so that they can
         # override anything they want to.  Populate the necessary output dir and strip path.
@@ -322,22 +472,41 @@ def generateDoxygenXML():
             # Tell doxygen to strip the path names (RTD builds produce long abs paths...)
             STRIP_FROM_PATH        = "{strip}"
         '''.format(out=doxy_dir, strip=configs.doxygenStripFromPath))
+        if configs.listingExcludeDoxygen:
+            # Appended so that any EXCLUDE_SYMBOLS in exhaleDoxygenStdin are kept.
+            exclude_symbols = []
+            for exclude in configs._compiled_listing_exclude:
+                symbol = utils.doxygenExcludeSymbol(exclude)
+                if symbol is None:
+                    logger.warning(utils.info(textwrap.dedent('''
+                        The `listingExclude` pattern `{0}` cannot be sent to Doxygen as an
+                        EXCLUDE_SYMBOLS pattern.  Doxygen will still process what it matches,
+                        but Exhale will skip it.
+                    '''.format(exclude.pattern)), utils.AnsiColors.BOLD_YELLOW),
+                        type="exhale", subtype="listing_exclude")
+                else:
+                    exclude_symbols.append("EXCLUDE_SYMBOLS       += \"{0}\"".format(symbol))
+            if exclude_symbols:
+                internal_configs = "{0}# Skip what listingExclude matches\n{1}\n".format(
+                    internal_configs, "\n".join(exclude_symbols)
+                )
         external_configs = textwrap.dedent(configs.exhaleDoxygenStdin)
         # Place external configs last so that if the _valid_config method isn't actually
         # catching what it should be, the internal configs will override theirs
-        full_input = "{base}\n{external}\n{internal}\n\n".format(base=configs.DEFAULT_DOXYGEN_STDIN_BASE,
+        base_configs = configs.DEFAULT_DOXYGEN_STDIN_BASE
+        if configs.exhaleDoxygenLean:
+            base_configs = "{0}\n{1}".format(base_configs, configs.DEFAULT_DOXYGEN_STDIN_LEAN)
+        full_input = "{base}\n{external}\n{internal}\n\n".format(base=base_configs,
                                                                  external=external_configs,
                                                                  internal=internal_configs)
 
         # << verboseBuild
         if configs.verboseBuild:
-            msg = "[*] The following input will be sent to Doxygen:\n"
-            if not configs.alwaysColorize and not sys.stderr.isatty():
-                sys.stderr.write(msg)
-                sys.stderr.write(full_input)
+            utils.verbose_log("[*] The following input will be sent to Doxygen:", utils.AnsiColors.BOLD_CYAN)
+            if configs.verboseBuildFile or (not configs.alwaysColorize and not sys.stdout.isatty()):
+                utils.verbose_log(full_input)
             else:
-                sys.stderr.write(utils.colorize(msg, utils.AnsiColors.BOLD_CYAN))
-                sys.stderr.write(utils.__fancy(full_input, "make", "console"))
+                utils.verbose_log(utils.__fancy(full_input, "make", "console"))
 
         return _generate_doxygen(full_input)
 
@@ -353,7 +522,7 @@ def generateDoxygenXML():
 ##
 #
 ########################################################################################
-def explode():
+def explode(write_trace=True, project_links=None):
     '''
     This method **assumes** that :func:`~exhale.configs.apply_sphinx_configurations` has
     already been applied.  It performs minimal sanity checking, and then performs in
@@ -369,6 +538,17 @@ def explode():
     back to Sphinx to now read in the source documents (many of which were just
     generated in :data:`~exhale.configs.containmentFolder`), and proceed to writing the
     final output.
+
+    **Parameters**
+        ``write_trace`` (bool)
+            Whether to write the trace being recorded to
+            :data:`~exhale.configs.traceFile` (when it is set).
+            :func:`~exhale.deploy.explodeProjects` writes it once every project is done
+            instead.
+
+        ``project_links`` (dict or ``None``)
+            The link index of every other project of ``exhale_projects``, see
+            :class:`~exhale.graph.ExhaleRoot`.
     '''
     # Quick sanity check to make sure the bare minimum have been set in the configs
     err_msg = "`configs.{config}` was `None`.  Do not call `deploy.explode` directly."
@@ -379,40 +559,38 @@ def explode():
     if configs.doxygenStripFromPath is None:
         raise RuntimeError(err_msg.format(config="doxygenStripFromPath"))
 
+    # Doxygen is a subprocess, the memory of this process is profiled from here.
+    if configs.memoryProfileFile:
+        metrics.current().profileMemory()
+
     # From here on, we assume that everything else has been checked / configured.
     try:
-        textRoot = ExhaleRoot()
+        textRoot = ExhaleRoot(configs.ProjectConfigs(configs._breathe_project), project_links)
     except:
         utils.fancyError("Unable to create an `ExhaleRoot` object:")
 
     try:
-        sys.stdout.write("{0}\n".format(utils.info("Exhale: parsing Doxygen XML.")))
+        logger.info(utils.info("Exhale: parsing Doxygen XML."))
         start = utils.get_time()
 
         textRoot.parse()
 
         end = utils.get_time()
-        sys.stdout.write("{0}\n".format(
-            utils.progress("Exhale: finished parsing Doxygen XML in {0}.".format(
-                utils.time_string(start, end)
-            ))
-        ))
+        logger.info(utils.progress("Exhale: finished parsing Doxygen XML in {0}.".format(
+            utils.time_string(start, end)
+        )))
     except:
         utils.fancyError("Exception caught while parsing:")
     try:
-        sys.stdout.write("{0}\n".format(
-            utils.info("Exhale: generating reStructuredText documents.")
-        ))
+        logger.info(utils.info("Exhale: generating reStructuredText documents."))
         start = utils.get_time()
 
         textRoot.generateFullAPI()
 
         end = utils.get_time()
-        sys.stdout.write("{0}\n".format(
-            utils.progress("Exhale: generated reStructuredText documents in {0}.".format(
-                utils.time_string(start, end)
-            ))
-        ))
+        logger.info(utils.progress("Exhale: generated reStructuredText documents in {0}.".format(
+            utils.time_string(start, end)
+        )))
     except:
         utils.fancyError("Exception caught while generating:")
 
@@ -422,3 +600,273 @@ def explode():
 
     # allow access to the result after-the-fact
     configs._the_app.exhale_root = textRoot
+
+    if configs.compoundCostReport:
+        logger.info("{0}\n{1}".format(
+            utils.info("Exhale: the most expensive compounds of [{0}].".format(configs._breathe_project)),
+            textRoot.metrics.formatCompoundReport()
+        ))
+
+    memory = textRoot.metrics.stopProfilingMemory()
+    if memory is not None:
+        try:
+            memory.writeReport(configs.memoryProfileFile, textRoot.metrics.phases, configs._breathe_project)
+        except Exception as e:
+            utils.fancyError(
+                "Unable to write the memory profile [{0}]: {1}".format(configs.memoryProfileFile, e)
+            )
+        logger.info(utils.progress(
+            "Exhale: wrote the memory profile to [{0}].".format(configs.memoryProfileFile)
+        ))
+
+    if configs.metricsFile:
+        nodes = {}
+        for node in textRoot.all_nodes:
+            nodes[node.kind] = nodes.get(node.kind, 0) + 1
+        try:
+            textRoot.metrics.writeJSON(configs.metricsFile, project=configs._breathe_project, nodes=nodes)
+        except Exception as e:
+            utils.fancyError("Unable to write the metrics file [{0}]: {1}".format(configs.metricsFile, e))
+    # On demand documents read the node data until the build finishes, see
+    # exhale/__init__.py:build_finished.
+    if not configs.onDemandGeneration:
+        textRoot.storage.close()
+
+    # the next project (or build) starts recording from scratch
+    metrics.reset()
+    utils.closeVerboseLog()
+
+    if write_trace and configs.traceFile and metrics.trace() is not None:
+        writeTrace()
+
+
+def writeTrace():
+    '''
+    Stop recording the trace and write it to :data:`~exhale.configs.traceFile`.
+    '''
+    trace = metrics.stopTrace()
+    try:
+        trace.writeJSON(configs.traceFile)
+    except Exception as e:
+        utils.fancyError("Unable to write the trace file [{0}]: {1}".format(configs.traceFile, e))
+    logger.info(utils.progress(
+        "Exhale: wrote {0} trace events to [{1}].".format(len(trace.events), configs.traceFile)
+    ))
+
+
+class _WorkerApp(object):
+    '''
+    What the worker processes of :func:`~exhale.deploy.explodeProjects` use of the
+    Sphinx application, which cannot be sent to another process.
+
+    **Parameters**
+        ``app`` (:class:`sphinx.application.Sphinx`)
+            The Sphinx Application running the documentation build.
+    '''
+    def __init__(self, app):
+        self.confdir = app.confdir
+        self.srcdir = app.srcdir
+        self.config = SimpleNamespace(
+            breathe_projects=dict(app.config.breathe_projects),
+            breathe_default_project=app.config.breathe_default_project,
+            exhale_args=dict(app.config.exhale_args)
+        )
+        self.exhale_root = None
+
+
+def _startWorker(project_configs, app, trace_origin):
+    # The worker processes are not forked from Sphinx, so everything comes in as
+    # arguments: activate the project, and set up what Sphinx set up in its process.
+    project_configs.activate()
+    configs._the_app = app
+    # Only the Sphinx process reads documents, there is nothing to defer to.
+    configs.onDemandGeneration = False
+    sphinx_logger = logging.getLogger("sphinx")
+    if not sphinx_logger.handlers:
+        sphinx_logger.addHandler(logging.StreamHandler(sys.stdout))
+        sphinx_logger.setLevel(logging.INFO)
+    if trace_origin is not None:
+        metrics.startTrace(trace_origin).nameProcess("exhale worker: {0}".format(project_configs.project))
+
+
+def _projectLinkIndex(project_configs):
+    # What the other projects may link to, see graph.ExhaleRoot.linkIndex.
+    with metrics.current().phase("linkIndex"):
+        return ExhaleRoot(project_configs).linkIndex()
+
+
+def _doxygenProject(project_configs, app, trace_origin):
+    # Runs in a worker process: run Doxygen for the project.  Returns the configuration
+    # afterward (prepare_doxygen_xml resolves some of it), the metrics recorded so far,
+    # the link index, and the trace events of this worker (when tracing).
+    _startWorker(project_configs, app, trace_origin)
+    project = project_configs.project
+    with metrics.span("doxygen {0}".format(project), "worker"):
+        configs.prepare_doxygen_xml(app)
+        project_configs = configs.ProjectConfigs(project)
+        links = _projectLinkIndex(project_configs)
+    trace = metrics.stopTrace()
+    return project_configs, metrics.current(), links, trace and trace.events
+
+
+def _explodeProject(project_configs, build_metrics, project_links, app, trace_origin):
+    # Runs in a worker process once Doxygen ran for every project: parse and generate,
+    # continuing the metrics of _doxygenProject.  Returns the number of documents, and
+    # the trace events of this worker (when tracing).
+    _startWorker(project_configs, app, trace_origin)
+    with metrics.recording(build_metrics):
+        with metrics.span("project {0}".format(project_configs.project), "worker"):
+            explode(write_trace=False, project_links=project_links)
+    trace = metrics.stopTrace()
+    return len(app.exhale_root.generatedDocuments()), trace and trace.events
+
+
+def explodeProjects(app, on_demand=True):
+    '''
+    Generate every project in ``exhale_projects`` (see
+    :class:`~exhale.configs.ProjectConfigs`) concurrently.
+
+    Every project is configured up front with
+    :func:`~exhale.configs.apply_sphinx_configurations`, so configuration errors are
+    reported before any work starts.  The work is done in a worker process per project,
+    except for ``breathe_default_project`` (or the first project when it is not in
+    ``exhale_projects``), which runs in this process while the workers do.  Its
+    configuration stays active afterward and its :class:`~exhale.graph.ExhaleRoot` is
+    ``app.exhale_root``, so :data:`~exhale.configs.onDemandGeneration` only applies to
+    that project.
+
+    The projects link to each other (see :func:`~exhale.graph.ExhaleRoot.projectLink`),
+    so this happens in two rounds: Doxygen runs for every project and each reports its
+    :func:`~exhale.graph.ExhaleRoot.linkIndex`, then every project is parsed and
+    generated given the link index of the others.
+
+    Sphinx may have threads running, so the workers are not forked from it: they are
+    started by a ``forkserver`` (or ``spawn``, where that is not available), and are
+    given the :class:`~exhale.configs.ProjectConfigs` of their project explicitly.
+
+    **Parameters**
+        ``app`` (:class:`sphinx.application.Sphinx`)
+            The Sphinx Application running the documentation build.
+
+        ``on_demand`` (bool)
+            Whether :data:`~exhale.configs.onDemandGeneration` may be honored for the
+            project generated in this process.  ``False`` when Sphinx is not running.
+    '''
+    projects = list(app.config.exhale_projects)
+    project_configs = {}
+    utils.resetVerboseLog()
+    containment_folders = {}
+    project_files = {}  # keys: (configuration, path), values: project
+    for project in projects:
+        configs._default_configs.activate()
+        configs.apply_sphinx_configurations(app, project, run_doxygen=False)
+        if configs.containmentFolder in containment_folders:
+            utils.fancyError(
+                "Exhale: projects '{0}' and '{1}' have the same `containmentFolder` [{2}].".format(
+                    containment_folders[configs.containmentFolder], project, configs.containmentFolder
+                )
+            )
+        containment_folders[configs.containmentFolder] = project
+        # Every project traces into one traceFile, the other files are one per project.
+        for key in configs.PROJECT_FILES:
+            path = getattr(configs, key)
+            if not path or key == "traceFile" or (key == "verboseBuildFile" and not configs.verboseBuild):
+                continue
+            if (key, path) in project_files:
+                logger.warning(utils.critical(
+                    "Exhale: projects '{0}' and '{1}' write the same `{2}` [{3}], one replaces the other.  "
+                    "Use {{project}} in the path to write one per project.".format(
+                        project_files[(key, path)], project, key, path
+                    )
+                ), type="exhale", subtype="project_files")
+            project_files[(key, path)] = project
+        project_configs[project] = configs.ProjectConfigs(project)
+
+    in_process = app.config.breathe_default_project
+    if in_process not in project_configs:
+        in_process = projects[0]
+    workers = [project for project in projects if project != in_process]
+
+    # Every project is traced into the traceFile of the project generated here.
+    project_configs[in_process].activate()
+    if configs.traceFile:
+        metrics.startTrace().nameProcess("exhale")
+    trace_origin = metrics.trace().origin if metrics.trace() is not None else None
+
+    start = utils.get_time()
+    logger.info(utils.info(
+        "Exhale: generating {0} projects: {1}.".format(len(projects), ", ".join(projects))
+    ))
+    executor = None
+    if workers:
+        if "forkserver" in multiprocessing.get_all_start_methods():
+            mp_context = multiprocessing.get_context("forkserver")
+        else:
+            mp_context = multiprocessing.get_context("spawn")
+        executor = ProcessPoolExecutor(
+            max_workers=min(len(workers), os.cpu_count() or 1), mp_context=mp_context
+        )
+        worker_app = _WorkerApp(app)
+
+    def results(futures, what):
+        # The result of every worker, in the order of `workers`.
+        ret = {}
+        for project in futures:
+            try:
+                ret[project] = futures[project].result()
+            except:
+                utils.fancyError("Exhale: could not {0} project '{1}':".format(what, project))
+            events = ret[project][-1]
+            if events and metrics.trace() is not None:
+                metrics.trace().events.extend(events)
+        return ret
+
+    try:
+        # Round one: Doxygen, and the link index of every project.
+        futures = {}
+        for project in workers:
+            futures[project] = executor.submit(
+                _doxygenProject, project_configs[project], worker_app, trace_origin
+            )
+        project_configs[in_process].activate()
+        if not on_demand:
+            configs.onDemandGeneration = False
+        with metrics.span("doxygen {0}".format(in_process), "project"):
+            configs.prepare_doxygen_xml(app)
+            project_configs[in_process] = configs.ProjectConfigs(in_process)
+            project_links = {in_process: _projectLinkIndex(project_configs[in_process])}
+        worker_metrics = {}
+        for project, (worker_configs, build_metrics, links, _) in results(futures, "run Doxygen for").items():
+            project_configs[project] = worker_configs
+            worker_metrics[project] = build_metrics
+            project_links[project] = links
+
+        def other_links(project):
+            return {other: project_links[other] for other in projects if other != project}
+
+        # Round two: parse and generate every project.
+        futures = {}
+        for project in workers:
+            futures[project] = executor.submit(
+                _explodeProject, project_configs[project], worker_metrics[project],
+                other_links(project), worker_app, trace_origin
+            )
+        project_configs[in_process].activate()
+        with metrics.span("project {0}".format(in_process), "project"):
+            explode(write_trace=False, project_links=other_links(in_process))
+
+        for project, (num_documents, _) in results(futures, "generate").items():
+            logger.info(utils.progress(
+                "Exhale: project '{0}' generated {1} documents.".format(project, num_documents)
+            ))
+    finally:
+        if executor is not None:
+            executor.shutdown()
+
+    end = utils.get_time()
+    logger.info(utils.progress(
+        "Exhale: generated {0} projects in {1}.".format(len(projects), utils.time_string(start, end))
+    ))
+
+    if configs.traceFile and metrics.trace() is not None:
+        writeTrace()
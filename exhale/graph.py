@@ -9,20 +9,26 @@
 from __future__ import unicode_literals
 
 from . import configs
+from . import metrics
 from . import parse
+from . import storage
 from . import utils
 
 import re
 import os
 import sys
 import codecs
+import contextlib
 import hashlib
 import itertools
+import json
 from pathlib import Path
 import platform
 import textwrap
+from xml.etree import ElementTree
 
 from bs4 import BeautifulSoup
+from sphinx.util import logging
 
 try:
     # Python 2 StringIO
@@ -33,6 +39,63 @@ except ImportError:
 
 __all__       = ["ExhaleRoot", "ExhaleNode"]
 
+logger = logging.getLogger(__name__)
+
+# The nested children of a class or struct in the Class Hierarchy, grouped (in order)
+# into class_like, enums, and unions.  Indexed by utils.Kind.
+_NESTED_CLASS_HIERARCHY_GROUP = utils.kindTable(
+    {utils.Kind.CLASS: 0, utils.Kind.STRUCT: 0, utils.Kind.ENUM: 1, utils.Kind.UNION: 2}, None
+)
+
+# The sections of a namespace document, and the section of each utils.Kind.  Classes and
+# structs are expanded to their nested class_like (1), enums (2), and unions (5).
+_NAMESPACE_CHILD_SECTIONS = ("Namespaces", "Classes", "Enums", "Functions", "Typedefs", "Unions", "Variables")
+_NAMESPACE_CHILD_SECTION = utils.kindTable(
+    {
+        utils.Kind.NAMESPACE: 0,
+        utils.Kind.ENUM:      2,
+        utils.Kind.FUNCTION:  3,
+        utils.Kind.TYPEDEF:   4,
+        utils.Kind.UNION:     5,
+        utils.Kind.VARIABLE:  6
+    },
+    None
+)
+
+
+# A name in a program listing, see ExhaleRoot.fileRefDiscovery.
+_IDENTIFIER_REGEX = re.compile(r"\w+")
+
+
+def _isDescription(tag):
+    # The children of a <compounddef> parse.getBriefAndDetailedRST reads.
+    return tag.name in ("briefdescription", "detaileddescription")
+
+
+def _isFunctionOrDescription(tag):
+    # ... and those ExhaleRoot.parseFunctionSignatures reads, see retainParsedXML.
+    return _isDescription(tag) or (tag.name == "sectiondef" and tag.get("kind", None) == "func")
+
+
+class _ChildSets(object):
+    # Appends children that are not there yet without scanning the list for each one,
+    # by tracking the identity of the children of every parent appended to.  Only valid
+    # while nothing else appends to those lists.
+    def __init__(self, attr="children"):
+        self.attr = attr
+        self.seen = {}
+
+    def append(self, parent, child):
+        children = getattr(parent, self.attr)
+        seen = self.seen.get(id(parent))
+        if seen is None:
+            seen = self.seen[id(parent)] = set(id(c) for c in children)
+        if id(child) in seen:
+            return False
+        seen.add(id(child))
+        children.append(child)
+        return True
+
 
 ########################################################################################
 #
@@ -142,7 +205,10 @@ class ExhaleNode(object):
 
         ``program_listing`` (list)
             A list of strings that is the Doxygen xml <programlisting>, without the
-            opening or closing <programlisting> tags.
+            opening or closing <programlisting> tags.  The ``includes``,
+            ``included_by``, and ``program_listing`` are a
+            :class:`~exhale.storage.StoredSequence` when
+            :data:`~exhale.configs.nodeDataStore` is ``"sqlite"``.
 
         ``program_file`` (list)
             Managed externally by the root similar to ``file_name`` etc, this is the
@@ -156,17 +222,34 @@ class ExhaleNode(object):
             ``program_file``. Set to ``None`` on creation, refer to
             :func:`~exhale.graph.ExhaleRoot.initializeNodeFilenameAndLink`.
     '''
+    # Large projects have hundreds of thousands of nodes, a per-instance __dict__ costs
+    # several times more than the attributes themselves.  The kind-specific attributes
+    # below are set for every node, the other kinds share empty values.
+    __slots__ = (
+        "name", "kind", "kind_code", "refid", "root_owner", "template_params", "base_compounds",
+        "derived_compounds", "def_in_file", "children", "parent", "file_name", "link_name",
+        "title", "in_page_hierarchy", "in_class_hierarchy", "in_file_hierarchy",
+        # kind == "file" (pages also have a location)
+        "namespaces_used", "includes", "included_by", "language", "location",
+        "program_listing", "program_file", "program_link_name",
+        # kind == "function"
+        "return_type", "parameters", "template"
+    )
+
     def __init__(self, name, kind, refid):
         self.name        = os.path.normpath(name) if kind == 'dir' else name
-        self.kind        = kind
+        # Every node of a kind shares the one string, rather than a copy per XML attribute.
+        self.kind        = sys.intern(kind)
+        self.kind_code   = utils.kindCode(kind)
         self.refid       = refid
         self.root_owner  = None  # the ExhaleRoot owner
 
-        self.template_params = []  # only populated if found
+        # Only a few nodes have these, they are replaced with a list when found.
+        self.template_params = ()
 
         # for inheritance
-        self.base_compounds = []
-        self.derived_compounds = []
+        self.base_compounds = ()
+        self.derived_compounds = ()
 
         # used for establishing a link to the file something was done in for leaf-like
         # nodes conveniently, files also have this defined as their name making
@@ -183,21 +266,27 @@ class ExhaleNode(object):
         self.in_page_hierarchy = False
         self.in_class_hierarchy = False
         self.in_file_hierarchy = False
-        # kind-specific additional information
+        # kind-specific additional information, every slot is set so that reading one
+        # never raises (the other kinds share the empty defaults)
         if self.kind == "file":
             self.namespaces_used   = []  # ExhaleNodes
             self.includes          = []  # strings
             self.included_by       = []  # (refid, name) tuples
-            self.language          = ""
-            self.location          = ""
             self.program_listing   = []  # strings
             self.program_file      = ""
-            self.program_link_name = ""
-
-        if self.kind == "function":
-            self.return_type = None # string (void, int, etc)
-            self.parameters = [] # list of strings: ["int", "int"] for foo(int x, int y)
-            self.template = None # list of strings
+        else:
+            self.namespaces_used   = ()
+            self.includes          = ()
+            self.included_by       = ()
+            self.program_listing   = ()
+            self.program_file      = None  # only files have a program listing document
+        self.language          = ""
+        self.location          = ""      # files and pages
+        self.program_link_name = ""
+
+        self.return_type = None # string (void, int, etc)
+        self.parameters = () # list of strings: ["int", "int"] for foo(int x, int y)
+        self.template = None # list of strings
 
     def __lt__(self, other):
         '''
@@ -212,8 +301,9 @@ class ExhaleNode(object):
             True if ``self`` is less than ``other``, False otherwise.
         '''
         # allows alphabetical sorting within types
-        if self.kind == other.kind:
-            if self.kind != "page":
+        kind_code = self.kind_code
+        if kind_code == other.kind_code and (kind_code != utils.Kind.UNKNOWN or self.kind == other.kind):
+            if kind_code != utils.Kind.PAGE:
                 return self.name.lower() < other.name.lower()
             else:
                 # Arbitrarily stuff "indexpage" refid to the front.  As doxygen presents
@@ -225,26 +315,13 @@ class ExhaleNode(object):
                 elif other.refid == "indexpage":
                     return False
 
-                # NOTE: kind of wasteful, but ordered_refs has ALL pages
-                # but realistically, there won't be *that* many pages. right? ;)
-                ordered_refs = [
-                    p.refid for p in self.root_owner.index_xml_page_ordering
-                ]
-                return ordered_refs.index(self.refid) < ordered_refs.index(other.refid)
-        # treat structs and classes as the same type
-        elif self.kind == "struct" or self.kind == "class":
-            if other.kind != "struct" and other.kind != "class":
-                return True
-            else:
-                if self.kind == "struct" and other.kind == "class":
-                    return True
-                elif self.kind == "class" and other.kind == "struct":
-                    return False
-                else:
-                    return self.name.lower() < other.name.lower()
-        # otherwise, sort based off the kind
-        else:
+                page_rank = self.root_owner.index_xml_page_rank
+                return page_rank[self.refid] < page_rank[other.refid]
+        # otherwise, sort based off the kind: structs, classes, then alphabetically
+        elif kind_code == utils.Kind.UNKNOWN and other.kind_code == utils.Kind.UNKNOWN:
             return self.kind < other.kind
+        else:
+            return utils.KIND_SORT_RANK[kind_code] < utils.KIND_SORT_RANK[other.kind_code]
 
     def __repr__(self):
         # NOTE: there will never be a way to eval(repr()) anything from this!  These are
@@ -276,6 +353,13 @@ class ExhaleNode(object):
         # needed to be able to track the page orderings as presented in index.xml
         self.root_owner = root
 
+    def project_configs(self):
+        """
+        The :class:`~exhale.configs.ProjectConfigs` of ``self.root_owner``, or the
+        :mod:`exhale.configs` module for a node without an owner.
+        """
+        return configs if self.root_owner is None else self.root_owner.configs
+
     def breathe_identifier(self):
         """
         The unique identifier for breathe directives.
@@ -426,7 +510,13 @@ class ExhaleNode(object):
             # TODO: how to do intersphinx links here?
             # NOTE: refid is *NOT* guaranteed to be in nodeByRefid
             #       https://github.com/svenevs/exhale/pull/103
+            link = None
             if refid and refid in nodeByRefid:
+                link = nodeByRefid[refid].link_name
+            elif not refid and self.root_owner is not None:
+                # Documented by another project of exhale_projects, if any.
+                link = self.root_owner.projectLink("compounds", string, self.name)
+            if link is not None:
                 # TODO: why are these links not working????????????????????????????????
                 ###########flake8breaks :/ :/ :/ :/ :/ :/ :/ :/ :/ :/ :/ :/ :/ :/ :/ :/
                 # if please_close:
@@ -442,7 +532,7 @@ class ExhaleNode(object):
                     bod_stream.write(" ")
                 bod_stream.write("{string}`` (:ref:`{link}`)".format(
                     string=string,
-                    link=nodeByRefid[refid].link_name
+                    link=link
                 ))
             else:
                 if not please_close:
@@ -626,7 +716,7 @@ class ExhaleNode(object):
             True if this node should be included in the page view --- if it is a
             node of kind ``page``. Returns False otherwise.
         '''
-        self.in_page_hierarchy = self.kind == "page"
+        self.in_page_hierarchy = self.kind_code == utils.Kind.PAGE
         return self.in_page_hierarchy
 
     def inClassHierarchy(self):
@@ -641,7 +731,7 @@ class ExhaleNode(object):
             ``namespace`` that one or more if its descendants was one of the previous
             four kinds.  Returns False otherwise.
         '''
-        if self.kind == "namespace":
+        if self.kind_code == utils.Kind.NAMESPACE:
             for c in self.children:
                 if c.inClassHierarchy():
                     return True
@@ -652,11 +742,11 @@ class ExhaleNode(object):
             self.in_class_hierarchy = True
 
             # Skip children whose names were requested to be explicitly ignored.
-            for exclude in configs._compiled_listing_exclude:
+            for exclude in self.project_configs()._compiled_listing_exclude:
                 if exclude.match(self.name):
                     return False
 
-            return self.kind in {"struct", "class", "enum", "union"}
+            return utils.KIND_IN_CLASS_HIERARCHY[self.kind_code]
 
     def inFileHierarchy(self):
         '''
@@ -669,12 +759,12 @@ class ExhaleNode(object):
             node of kind ``file``, or it is a ``dir`` that one or more if its
             descendants was a ``file``.  Returns False otherwise.
         '''
-        if self.kind == "file":
+        if self.kind_code == utils.Kind.FILE:
             # flag that this file is already in the directory view so that potential
             # missing files can be found later.
             self.in_file_hierarchy = True
             return True
-        elif self.kind == "dir":
+        elif self.kind_code == utils.Kind.DIR:
             for c in self.children:
                 if c.inFileHierarchy():
                     return True
@@ -699,29 +789,21 @@ class ExhaleNode(object):
             return sorted(self.children)
         elif hierarchyType == "class":
             # search for nested children to display as sub-items in the tree view
-            if self.kind == "class" or self.kind == "struct":
-                # first find all of the relevant children
-                nested_class_like = []
-                nested_enums      = []
-                nested_unions     = []
+            if utils.KIND_IS_CLASS_LIKE[self.kind_code]:
+                # first find all of the relevant children: class_like, enums, unions
+                nested = ([], [], [])
                 # important: only scan self.children, do not use recursive findNested* methods
                 for c in self.children:
-                    if c.kind == "struct" or c.kind == "class":
-                        nested_class_like.append(c)
-                    elif c.kind == "enum":
-                        nested_enums.append(c)
-                    elif c.kind == "union":
-                        nested_unions.append(c)
+                    group = _NESTED_CLASS_HIERARCHY_GROUP[c.kind_code]
+                    if group is not None:
+                        nested[group].append(c)
 
                 # sort the lists we just found
-                nested_class_like.sort()
-                nested_enums.sort()
-                nested_unions.sort()
+                for group in nested:
+                    group.sort()
 
                 # return a flattened listing with everything in the order it should be
-                return [
-                    child for child in itertools.chain(nested_class_like, nested_enums, nested_unions)
-                ]
+                return [child for child in itertools.chain(*nested)]
             # namespaces include nested namespaces, and any top-level class_like, enums,
             # and unions.  include nested namespaces first
             elif self.kind == "namespace":
@@ -794,6 +876,7 @@ class ExhaleNode(object):
 
         .. todo:: add thorough documentation of this
         '''
+        project_configs = self.project_configs()
         # NOTE: indexpage needs to be treated specially, you need to include the
         # children at the *same* level, and not actually include indexpage.
         if hierarchyType == "page" and self.refid == "indexpage":
@@ -814,7 +897,7 @@ class ExhaleNode(object):
             # Write out this node.                                                     #
             ############################################################################
             # Easy case: just write another bullet point
-            if not configs.createTreeView:
+            if not project_configs.createTreeView:
                 stream.write("{indent}- :ref:`{link}`\n".format(
                     indent='    ' * level,
                     link=self.link_name
@@ -861,9 +944,9 @@ class ExhaleNode(object):
                     link_title=link_title
                 )
 
-                if configs.treeViewIsBootstrap:
+                if project_configs.treeViewIsBootstrap:
                     text = "text: \"<span class=\\\"{span_cls}\\\">{qualifier}</span> {link_title}\"".format(
-                        span_cls=configs.treeViewBootstrapTextSpanClass,
+                        span_cls=project_configs.treeViewBootstrapTextSpanClass,
                         qualifier=qualifier,
                         link_title=link_title
                     )
@@ -884,7 +967,7 @@ class ExhaleNode(object):
                     ))
                     # if requested, add the badge indicating how many children there are
                     # only add this if there are children
-                    if configs.treeViewBootstrapUseBadgeTags and nested_children:
+                    if project_configs.treeViewBootstrapUseBadgeTags and nested_children:
                         stream.write("{next_indent}tags: ['{num_children}'],\n".format(
                             next_indent=next_indent,
                             num_children=len(nested_children)
@@ -941,8 +1024,8 @@ class ExhaleNode(object):
             ############################################################################
             # If there were children, close the lists we started above.                #
             ############################################################################
-            if configs.createTreeView and nested_children:
-                if configs.treeViewIsBootstrap:
+            if project_configs.createTreeView and nested_children:
+                if project_configs.treeViewIsBootstrap:
                     # close the `nodes: [ ... ]` and final } for element
                     # the final comma IS necessary, and extra commas don't matter in javascript
                     stream.write("{next_indent}]\n{indent}}},\n".format(
@@ -978,9 +1061,23 @@ class ExhaleRoot(object):
     .. todo::
 
        many attributes currently stored do not need to be, refactor in future release
-       to just use the ``configs`` module.
+       to just use ``self.configs``.
+
+    **Parameters**
+        ``project_configs`` (:class:`~exhale.configs.ProjectConfigs` or ``None``)
+            The configuration of the project to document, every method reads it rather
+            than the variables of :mod:`exhale.configs`.  ``None`` takes a snapshot of
+            those variables.
+
+        ``project_links`` (dict or ``None``)
+            The :func:`~exhale.graph.ExhaleRoot.linkIndex` of every other project of
+            ``exhale_projects`` keyed by project, see
+            :func:`~exhale.graph.ExhaleRoot.projectLink`.
 
     **Attributes**
+        ``configs`` (:class:`~exhale.configs.ProjectConfigs`)
+            The value of the parameter ``project_configs``.
+
         ``root_directory`` (str)
             The value of the parameter ``rootDirectory``.
 
@@ -1020,6 +1117,11 @@ class ExhaleRoot(object):
             ExhaleNode it came from.  Storing it this way is convenient for when the
             Doxygen xml file is being parsed.
 
+        ``metrics`` (:class:`~exhale.metrics.BuildMetrics`)
+            The time, files read, documents parsed, and pages written of every phase of
+            :func:`~exhale.graph.ExhaleRoot.parse` and
+            :func:`~exhale.graph.ExhaleRoot.generateFullAPI`, as well as running Doxygen.
+
         ``class_like`` (list)
             The full list of ExhaleNodes of kind ``struct`` or ``class``
 
@@ -1056,20 +1158,29 @@ class ExhaleRoot(object):
         ``variables`` (list)
             The full list of ExhaleNodes of kind ``variable``.
     '''
-    def __init__(self):
+    def __init__(self, project_configs=None, project_links=None):
+        if project_configs is None:
+            project_configs = configs.ProjectConfigs(configs._breathe_project)
+        self.configs = project_configs
+        # The link index of every other project, and what each include or class name
+        # was resolved to against them (see projectLink).
+        self.project_links = project_links or {}
+        self.project_link_cache = {}
+        self.project_files_by_basename = {}
+
         # file generation location and root index data
-        self.root_directory         = configs.containmentFolder
-        self.root_file_name         = configs.rootFileName
+        self.root_directory         = self.configs.containmentFolder
+        self.root_file_name         = self.configs.rootFileName
         self.full_root_file_path    = os.path.join(self.root_directory, self.root_file_name)
         # These documents are all included in the root file document.
-        self.page_hierarchy_file    = os.path.join(self.root_directory, configs.pageHierarchyFilename)
-        self.class_hierarchy_file   = os.path.join(self.root_directory, configs.classHierarchyFilename)
-        self.file_hierarchy_file    = os.path.join(self.root_directory, configs.fileHierarchyFilename)
-        self.unabridged_api_file    = os.path.join(self.root_directory, configs.unabridgedApiFilename)
-        self.unabridged_orphan_file = os.path.join(self.root_directory, configs.unabridgedOrphanFilename)
+        self.page_hierarchy_file    = os.path.join(self.root_directory, self.configs.pageHierarchyFilename)
+        self.class_hierarchy_file   = os.path.join(self.root_directory, self.configs.classHierarchyFilename)
+        self.file_hierarchy_file    = os.path.join(self.root_directory, self.configs.fileHierarchyFilename)
+        self.unabridged_api_file    = os.path.join(self.root_directory, self.configs.unabridgedApiFilename)
+        self.unabridged_orphan_file = os.path.join(self.root_directory, self.configs.unabridgedOrphanFilename)
 
         # whether or not we should generate the raw html tree view
-        self.use_tree_view = configs.createTreeView
+        self.use_tree_view = self.configs.createTreeView
 
         # track all compounds to build all nodes (ExhaleNodes)
         self.all_compounds = []##### update how this is used (compounds inserted are from xml parsing)
@@ -1121,6 +1232,58 @@ class ExhaleRoot(object):
         # the only node not placed in here is "indexpage" since it is not
         # included in the page view hierarchy (indexpage is dumped right above)
         self.index_xml_page_ordering = []
+        # the position of each refid in index_xml_page_ordering, for sorting pages
+        self.index_xml_page_rank = {}
+
+        # configs.doxygenStripFromPath normalized once, and every path Doxygen reported
+        # mapped to the (interned) result of strippedPath.
+        if self.configs.doxygenStripFromPath is not None:
+            self.abs_strip_path = os.path.normpath(os.path.abspath(self.configs.doxygenStripFromPath))
+        else:
+            self.abs_strip_path = None
+        self.stripped_paths = {}
+
+        # Every {refid}.xml parsed with BeautifulSoup, keyed by refid.  Each document is
+        # parsed at most once, see parsedCompoundXML and releaseParsedXML.  Once parsing
+        # is done with a document, only what later stages read is kept and the refid is
+        # added to partial_xml, see retainParsedXML.
+        self.parsed_xml = {}
+        self.partial_xml = set()
+
+        # Where every {refid}.xml is in configs.doxygenCombinedXML when it is used (see
+        # indexCombinedXML), otherwise None.
+        self.combined_xml = None
+
+        # What each phase of parsing and generating cost, see exhale.metrics.  This
+        # includes running Doxygen, recorded before this root was created.
+        self.metrics = metrics.current()
+        if self.configs.compoundCostReport:
+            self.metrics.trackCompounds(self.configs.compoundCostReport)
+
+        # Where program listings, includes, and function signatures are kept, see
+        # configs.nodeDataStore.
+        self.storage = storage.makeNodeDataStore(self.configs.nodeDataStore)
+
+        # The <memberdef> of every node in utils.MEMBER_KINDS keyed by refid (None once
+        # rendered), and the refids of the compounds they were gathered from.  Only used
+        # when configs.nativeMemberRendering is set, see memberDefinition.
+        self.member_definitions = {}
+        self.member_definition_sources = set()
+
+        # The file nodes keyed by their (normalized) location, filled once all files are
+        # discovered.  See fileForLocation.
+        self.files_by_location = {}
+        # The file node (or None) of every #include, and the file nodes keyed by the
+        # name of the file (filled when first needed).  See includedFile.
+        self.include_files = {}
+        self.files_by_basename = {}
+
+        # When configs.onDemandGeneration is set, the node documents are rendered as
+        # Sphinx reads them.  Keys are docnames, values are (generator, node) pairs.
+        # See deferNodeDocuments and renderOnDemandDocument.
+        self.on_demand_documents = {}
+        # The stream openGeneratedDocument hands out while rendering on demand.
+        self._render_stream = None
 
     ####################################################################################
     #
@@ -1145,44 +1308,111 @@ class ExhaleRoot(object):
         5. :func:`~exhale.graph.ExhaleRoot.filePostProcess`
         6. :func:`~exhale.graph.ExhaleRoot.parseFunctionSignatures`.
         7. :func:`~exhale.graph.ExhaleRoot.sortInternals`
+
+        Each step is recorded as a phase of ``self.metrics`` (see :mod:`exhale.metrics`).
+        '''
+        with self.metrics.phase("parse"):
+            with self.metrics.phase("discoverAllNodes") as phase:
+                self.discoverAllNodes()
+                phase["nodes"] = len(self.all_nodes)
+            # now reparent everything we can
+            # NOTE: it's very important that this happens before `fileRefDiscovery`, since
+            #       in that method we only want to consider direct descendants
+            with self.metrics.phase("reparentAll"):
+                self.reparentAll()
+
+            # now that we have all of the nodes, store them in a convenient manner for refid
+            # lookup when parsing the Doxygen xml files
+            for n in self.all_nodes:
+                self.node_by_refid[n.refid] = n
+
+            # find missing relationships using the Doxygen xml files
+            with self.metrics.phase("fileRefDiscovery"):
+                self.fileRefDiscovery()
+            with self.metrics.phase("filePostProcess"):
+                self.filePostProcess()
+
+            # gather the function signatures
+            with self.metrics.phase("parseFunctionSignatures"):
+                self.parseFunctionSignatures()
+                self.storage.commit()
+
+            # sort all of the lists we just built
+            with self.metrics.phase("sortInternals"):
+                self.sortInternals()
+
+    def parsedCompoundXML(self, node, fresh=False):
         '''
-        self.discoverAllNodes()
-        # now reparent everything we can
-        # NOTE: it's very important that this happens before `fileRefDiscovery`, since
-        #       in that method we only want to consider direct descendants
-        self.reparentAll()
+        Return the parsed ``{refid}.xml`` document for ``node``.  The parsing stages as
+        well as :func:`~exhale.parse.getBriefAndDetailedRST` share the documents in
+        ``self.parsed_xml`` so that each is only parsed once per build.
 
-        # now that we have all of the nodes, store them in a convenient manner for refid
-        # lookup when parsing the Doxygen xml files
-        for n in self.all_nodes:
-            self.node_by_refid[n.refid] = n
+        :Parameters:
+            ``node`` (ExhaleNode)
+                The node to get the Doxygen XML document of.
 
-        # find missing relationships using the Doxygen xml files
-        self.fileRefDiscovery()
-        self.filePostProcess()
+            ``fresh`` (bool)
+                Parse the document again, neither using nor keeping the shared one (which
+                rendering may have modified, or :func:`~exhale.graph.ExhaleRoot.retainParsedXML`
+                reduced).
 
-        # gather the function signatures
-        self.parseFunctionSignatures()
+        :Return (BeautifulSoup or None):
+            The parsed document, or ``None`` when there is no ``{refid}.xml``.
+        '''
+        soup = None if fresh else self.parsed_xml.get(node.refid, None)
+        if soup is None:
+            with self.metrics.compound(node, "parse") as cost:
+                node_xml_contents = self.compoundXMLContents(node)
+                if not node_xml_contents:
+                    return None
+                soup = BeautifulSoup(node_xml_contents, "lxml-xml")
+                metrics.parsed("{0}.xml".format(node.refid))
+                if cost is not None:
+                    cost["bytes"] = len(node_xml_contents)
+            if self.storage.keep_parsed_xml and not fresh:
+                self.parsed_xml[node.refid] = soup
+        return soup
+
+    def compoundXMLContents(self, node):
+        '''
+        Return the text of the ``{refid}.xml`` document for ``node``, taken from
+        :data:`~exhale.configs.doxygenCombinedXML` when it is in use.
 
-        # sort all of the lists we just built
-        self.sortInternals()
+        :Parameters:
+            ``node`` (ExhaleNode)
+                The node to get the Doxygen XML document of.
 
-    def discoverAllNodes(self):
+        :Return (str or None):
+            The document, or ``None`` when there is no ``{refid}.xml``.
         '''
-        .. todo:: node discovery has changed, breathe no longer used...update docs
+        if self.combined_xml is not None:
+            return self.combined_xml.get(node.refid, None)
+        return utils.nodeCompoundXMLContents(node, self.configs)
+
+    def indexCompounds(self):
+        '''
+        Gather every compound Doxygen documented, either from ``index.xml`` or by reading
+        :data:`~exhale.configs.doxygenCombinedXML` (which also records where every
+        compound is in ``self.combined_xml``).
+
+        :Return (list):
+            One ``(name, kind, refid, members)`` tuple per compound, in the order
+            Doxygen lists them.  ``members`` is a list of ``(name, kind, refid)``.
         '''
+        if self.configs.doxygenCombinedXML:
+            return self.indexCombinedXML(self.configs.doxygenCombinedXML)
+
         doxygen_index_xml = os.path.join(
-            configs._doxygen_xml_output_directory,
+            self.configs._doxygen_xml_output_directory,
             "index.xml"
         )
-        try:
-            with codecs.open(doxygen_index_xml, "r", "utf-8") as index:
-                index_contents = index.read()
-        except:
+        index_contents = utils.readDoxygenXML("index.xml", self.configs)
+        if index_contents is None:
             raise RuntimeError("Could not read the contents of [{0}].".format(doxygen_index_xml))
 
         try:
             index_soup = BeautifulSoup(index_contents, "lxml-xml")
+            metrics.parsed("index.xml")
         except:
             raise RuntimeError("Could not parse the contents of [{0}] as an xml.".format(doxygen_index_xml))
 
@@ -1192,44 +1422,358 @@ class ExhaleRoot(object):
                 "Did not find root XML node named 'doxygenindex' parsing [{0}].".format(doxygen_index_xml)
             )
 
+        compounds = []
         for compound in doxygen_root.find_all("compound"):
             if compound.find("name") and "kind" in compound.attrs and "refid" in compound.attrs:
-                curr_name  = compound.find("name").get_text()
-                curr_kind  = compound.attrs["kind"]
-                curr_refid = compound.attrs["refid"]
-                curr_node  = ExhaleNode(curr_name, curr_kind, curr_refid)
-                self.trackNodeIfUnseen(curr_node)
-
-                # For things like files and namespaces, a "member" list will include
-                # things like defines, enums, etc.  For classes and structs, we don't
-                # need to pay attention because the members are the various methods or
-                # data members by the class
-                if curr_kind in ["file", "namespace"]:
-                    for member in compound.find_all("member"):
-                        if member.find("name") and "kind" in member.attrs and "refid" in member.attrs:
-                            child_name  = member.find("name").get_text()
-                            child_kind  = member.attrs["kind"]
-                            child_refid = member.attrs["refid"]
-                            child_node  = ExhaleNode(child_name, child_kind, child_refid)
-                            self.trackNodeIfUnseen(child_node)
-
-                            if curr_kind == "namespace":
-                                child_node.parent = curr_node
-                            else:  # curr_kind == "file"
-                                child_node.def_in_file = curr_node
-
-                            curr_node.children.append(child_node)
+                members = []
+                for member in compound.find_all("member"):
+                    if member.find("name") and "kind" in member.attrs and "refid" in member.attrs:
+                        members.append(
+                            (member.find("name").get_text(), member.attrs["kind"], member.attrs["refid"])
+                        )
+                compounds.append(
+                    (compound.find("name").get_text(), compound.attrs["kind"], compound.attrs["refid"], members)
+                )
+        return compounds
 
-        for page in self.pages:
-            node_xml_contents = utils.nodeCompoundXMLContents(page)
-            if node_xml_contents:
+    def indexCombinedXML(self, combined_path):
+        '''
+        Helper method for :func:`~exhale.graph.ExhaleRoot.indexCompounds`.  Reads the
+        combined document once, recording where each ``<compounddef>`` is in
+        ``self.combined_xml`` (a :class:`~exhale.utils.CombinedCompounds`, which reads
+        it back when it is parsed) and building the same listing ``index.xml`` provides.
+
+        :Parameters:
+            ``combined_path`` (str)
+                The absolute path to the combined document.
+
+        :Return (list):
+            See :func:`~exhale.graph.ExhaleRoot.indexCompounds`.
+        '''
+        self.combined_xml = utils.CombinedCompounds(combined_path)
+        compounds = []
+        try:
+            for offset, compounddef in utils.iterCombinedCompounds(combined_path):
+                # Only the listing is needed now, BeautifulSoup parses the compound later.
+                cdef = ElementTree.fromstring(compounddef)
+                refid = cdef.get("id")
+                kind = cdef.get("kind")
+                if not refid or not kind:
+                    continue
+                self.combined_xml.add(refid, offset, len(compounddef))
+
+                members = []
+                for sectiondef in cdef.iter("sectiondef"):
+                    for memberdef in sectiondef.findall("memberdef"):
+                        members.append((memberdef.findtext("name", ""), memberdef.get("kind"), memberdef.get("id")))
+                        for enumvalue in memberdef.findall("enumvalue"):
+                            members.append((enumvalue.findtext("name", ""), "enumvalue", enumvalue.get("id")))
+                compounds.append((cdef.findtext("compoundname", ""), kind, refid, members))
+        except Exception as e:
+            raise RuntimeError("Could not read the combined Doxygen XML [{0}]: {1}".format(combined_path, e))
+        return compounds
+
+    def releaseParsedXML(self, refids):
+        '''
+        Drop parsed documents no later stage needs from ``self.parsed_xml``.
+
+        :Parameters:
+            ``refids`` (list)
+                The refids of the documents to release.
+        '''
+        for refid in refids:
+            self.parsed_xml.pop(refid, None)
+            self.partial_xml.discard(refid)
+
+    def retainParsedXML(self, refid, keep):
+        '''
+        Reduce the parsed document of ``refid`` to the children of its ``<compounddef>``
+        a later stage reads, destroying the rest (e.g., the ``<programlisting>`` of a
+        file).  Stages that need the whole document parse it again, see
+        :func:`~exhale.graph.ExhaleRoot.memberDefinition`.
+
+        :Parameters:
+            ``refid`` (str)
+                The refid of the document, nothing happens when it is not parsed.
+
+            ``keep`` (callable)
+                Given a child of the ``<compounddef>``, whether to keep it.
+        '''
+        soup = self.parsed_xml.get(refid, None)
+        if soup is None:
+            return
+        cdef = soup.doxygen.compounddef if soup.doxygen else None
+        if cdef is None:
+            self.releaseParsedXML([refid])
+            return
+        for child in cdef.find_all(True, recursive=False):
+            if not keep(child):
+                child.decompose()
+        self.partial_xml.add(refid)
+
+    def fileForLocation(self, location):
+        '''
+        Find the file node a ``<location>`` tag refers to.  The ``file`` attribute is
+        where the item was defined, ``declfile`` (when present) is where it was declared,
+        e.g., a function declared in a header but defined in a source file that was not
+        given to Doxygen.
+
+        :Parameters:
+            ``location`` (bs4.element.Tag or None)
+                The ``<location>`` of a ``<compounddef>`` or ``<memberdef>``.
+
+        :Return (ExhaleNode or None):
+            The file node, or ``None`` if ``location`` is ``None`` or no file matched.
+        '''
+        if not location:
+            return None
+        for attr in ("file", "declfile"):
+            if attr not in location.attrs:
+                continue
+            f = self.files_by_location.get(self.strippedPath(location.attrs[attr]), None)
+            if f is not None:
+                return f
+        return None
+
+    def includedFile(self, include):
+        '''
+        Find the file node an ``#include`` of a file document refers to: the first file
+        whose location ends with the included path or, if there is none (e.g.,
+        ``<vector>``), the first file whose location contains it.  The result is cached
+        per ``include``, most files include the same few headers.
+
+        :Parameters:
+            ``include`` (str)
+                The included path, as it appears in the ``<includes>`` tag.
+
+        :Return (ExhaleNode or None):
+            The file node, or ``None`` if no file matched.
+        '''
+        if include in self.include_files:
+            return self.include_files[include]
+        if not self.files_by_basename:
+            for f in self.files:
+                self.files_by_basename.setdefault(os.path.basename(f.location), []).append(f)
+
+        path = os.path.normpath(include)
+        found = None
+        for f in self.files_by_basename.get(os.path.basename(path), ()):
+            if f.location == path or f.location.endswith(os.sep + path):
+                found = f
+                break
+        if found is None:
+            for f in self.files:
+                if include in f.location:
+                    found = f
+                    break
+        self.include_files[include] = found
+        return found
+
+    def linkIndex(self):
+        '''
+        What other projects of ``exhale_projects`` may link to, read from the Doxygen XML
+        without parsing the graph (see :func:`~exhale.deploy.explodeProjects`): the
+        location of every file, and the fully qualified name of every class, struct, and
+        union, with the ``link_name`` :func:`~exhale.graph.ExhaleRoot.parse` and
+        :func:`~exhale.graph.ExhaleRoot.generateFullAPI` will give them.
+
+        :Return (dict):
+            ``{"files": {location: link_name}, "compounds": {name: link_name}}``.
+        '''
+        files = {}
+        compounds = {}
+        for name, kind, refid, members in self.indexCompounds():
+            node = ExhaleNode(name, kind, refid)
+            if kind == "file":
+                # The location of the <compounddef> is the last one, after every member.
+                contents = self.compoundXMLContents(node) or ""
+                start = contents.rfind("<location ")
+                if start < 0:
+                    continue
                 try:
-                    page.soup = BeautifulSoup(node_xml_contents, "lxml-xml")
-                except:
-                    utils.fancyError("Unable to parse file xml [{0}]:".format(page.name))
+                    location = ElementTree.fromstring(contents[start:contents.index(">", start) + 1])
+                except Exception:
+                    continue
+                if not location.get("file"):
+                    continue
+                node.location = self.strippedPath(location.get("file"))
+                self.initializeNodeFilenameAndLink(node)
+                files[node.location] = node.link_name
+            elif kind in ("class", "struct", "union"):
+                self.initializeNodeFilenameAndLink(node)
+                compounds[name] = node.link_name
+        # This root is only used for the index.
+        if self.combined_xml is not None:
+            self.combined_xml.close()
+        self.storage.close()
+        return {"files": files, "compounds": compounds}
+
+    def projectLink(self, kind, name, scope=None):
+        '''
+        Resolve an ``#include`` or a base / derived class name this project does not
+        document against the :func:`~exhale.graph.ExhaleRoot.linkIndex` of the other
+        projects (``self.project_links``), in the order they were given.
+
+        :Parameters:
+            ``kind`` (str)
+                ``"files"`` for an included path, matched like
+                :func:`~exhale.graph.ExhaleRoot.includedFile` (without the substring
+                fallback).  ``"compounds"`` for a class name, template arguments are
+                ignored.
+
+            ``name`` (str)
+                The included path, or the class name as Doxygen wrote it.
+
+            ``scope`` (str or None)
+                For ``"compounds"``, the scope the name was used in (e.g., the name of
+                the derived class), the enclosing scopes are tried innermost first.
+
+        :Return (str or None):
+            The ``link_name`` in the other project, or ``None``.
+        '''
+        if not self.project_links or not name:
+            return None
+        key = (kind, name, scope)
+        if key in self.project_link_cache:
+            return self.project_link_cache[key]
+
+        found = None
+        if kind == "files":
+            if not self.project_files_by_basename:
+                for project in self.project_links:
+                    by_basename = self.project_files_by_basename.setdefault(project, {})
+                    for location, link in self.project_links[project]["files"].items():
+                        by_basename.setdefault(os.path.basename(location), []).append((location, link))
+            path = os.path.normpath(name)
+            for project in self.project_links:
+                for location, link in self.project_files_by_basename[project].get(os.path.basename(path), ()):
+                    if location == path or location.endswith(os.sep + path):
+                        found = link
+                        break
+                if found is not None:
+                    break
+        else:
+            base = name.split("<", 1)[0].strip()
+            candidates = []
+            while scope:
+                scope = utils.parentScope(scope)
+                if scope:
+                    candidates.append("{0}::{1}".format(scope, base))
+            candidates.append(base.lstrip(":"))
+            for project in self.project_links:
+                compounds = self.project_links[project]["compounds"]
+                found = next((compounds[c] for c in candidates if c in compounds), None)
+                if found is not None:
+                    break
+        self.project_link_cache[key] = found
+        return found
+
+    def strippedPath(self, path):
+        '''
+        Normalize a path Doxygen reported, removing :data:`~exhale.configs.doxygenStripFromPath`
+        (some older versions of doxygen don't reliably strip from path).  Every member
+        reports the location of its file, so the result is cached per input ``path``.
+
+        :Parameters:
+            ``path`` (str)
+                The path, e.g., the ``file`` attribute of a ``<location>`` tag.
+
+        :Return (str):
+            The normalized path, relative to ``doxygenStripFromPath`` when it was below it.
+            Equal results are the same (interned) string.
+        '''
+        stripped = self.stripped_paths.get(path, None)
+        if stripped is None:
+            stripped = os.path.normpath(path)
+            if self.abs_strip_path is not None and stripped.startswith(self.abs_strip_path):
+                stripped = os.path.normpath(os.path.relpath(stripped, self.abs_strip_path))
+            stripped = sys.intern(stripped)
+            self.stripped_paths[path] = stripped
+        return stripped
+
+    def listingExcludedRefids(self, compounds):
+        '''
+        Find the compounds and members :data:`~exhale.configs.listingExcludeDoxygen`
+        removes, see :func:`~exhale.utils.listingExcluded`.
+
+        :Parameters:
+            ``compounds`` (list)
+                The return value of :func:`~exhale.graph.ExhaleRoot.indexCompounds`.
+
+        :Return (set):
+            The refids of everything that should not be discovered.
+        '''
+        excluded = set()
+        if not self.configs.listingExcludeDoxygen or not self.configs._compiled_listing_exclude:
+            return excluded
+
+        # The index lists members by their unqualified name, qualify them with the
+        # namespace they are in.  Members only listed by a file are in the global scope.
+        member_names = {}  # keys: refid, values: fully qualified name
+        for name, kind, refid, members in compounds:
+            if kind == "namespace":
+                for child_name, child_kind, child_refid in members:
+                    member_names[child_refid] = "{0}::{1}".format(name, child_name)
+        for name, kind, refid, members in compounds:
+            if kind == "file":
+                for child_name, child_kind, child_refid in members:
+                    member_names.setdefault(child_refid, child_name)
+            elif kind not in ("dir", "page", "group", "example") and utils.listingExcluded(name, self.configs):
+                excluded.add(refid)
+
+        for refid in member_names:
+            if utils.listingExcluded(member_names[refid], self.configs):
+                excluded.add(refid)
+        return excluded
+
+    def discoverAllNodes(self):
+        '''
+        .. todo:: node discovery has changed, breathe no longer used...update docs
+        '''
+        compounds = self.indexCompounds()
+        excluded = self.listingExcludedRefids(compounds)
+        if excluded:
+            # << verboseBuild
+            utils.verbose_log(
+                "listingExcludeDoxygen: skipping [{0}] compounds and members.", utils.AnsiColors.BOLD_MAGENTA,
+                len(excluded)
+            )
+            if self.combined_xml is not None:
+                for refid in excluded:
+                    self.combined_xml.pop(refid, None)
+        for curr_name, curr_kind, curr_refid, members in compounds:
+            if curr_refid in excluded:
+                continue
+            curr_node = ExhaleNode(curr_name, curr_kind, curr_refid)
+            self.trackNodeIfUnseen(curr_node)
+
+            # For things like files and namespaces, a "member" list will include
+            # things like defines, enums, etc.  For classes and structs, we don't
+            # need to pay attention because the members are the various methods or
+            # data members by the class
+            if curr_kind in ["file", "namespace"]:
+                for child_name, child_kind, child_refid in members:
+                    if child_refid in excluded:
+                        continue
+                    child_node = ExhaleNode(child_name, child_kind, child_refid)
+                    self.trackNodeIfUnseen(child_node)
 
+                    if curr_kind == "namespace":
+                        child_node.parent = curr_node
+                    else:  # curr_kind == "file"
+                        child_node.def_in_file = curr_node
+
+                    curr_node.children.append(child_node)
+
+        page_children = _ChildSets()
+        for page in self.pages:
+            try:
+                page_soup = self.parsedCompoundXML(page)
+            except:
+                utils.fancyError("Unable to parse file xml [{0}]:".format(page.name))
+            if page_soup:
                 try:
-                    cdef = page.soup.doxygen.compounddef
+                    cdef = page_soup.doxygen.compounddef
 
                     title = cdef.find("title")
                     if title and title.string:
@@ -1240,9 +1784,10 @@ class ExhaleRoot(object):
                     # process subpages
                     inner_pages = cdef.find_all("innerpage", recursive=False)
 
+                    # << verboseBuild
                     utils.verbose_log(
-                        "*** [{0}] had [{1}] innerpages found".format(page.name, len(inner_pages)),
-                        utils.AnsiColors.BOLD_MAGENTA
+                        "*** [{0}] had [{1}] innerpages found", utils.AnsiColors.BOLD_MAGENTA,
+                        page.name, len(inner_pages)
                     )
 
                     for subpage in inner_pages:
@@ -1252,41 +1797,31 @@ class ExhaleRoot(object):
                                 node = self.node_by_refid[refid]
 
                                 # << verboseBuild
-                                utils.verbose_log(
-                                    "    - [{0}]".format(node.name),
-                                    utils.AnsiColors.BOLD_MAGENTA
-                                )
-
-                                if node.parent:
-                                    utils.verbose_log(
-                                        err_dup.format(node.name, node.parent.name, page.name),
-                                        utils.AnsiColors.BOLD_YELLOW
-                                    )
-
-                                if node not in page.children:
-                                    page.children.append(node)
+                                if self.configs.verboseBuild:
+                                    utils.verbose_log("    - [{0}]", utils.AnsiColors.BOLD_MAGENTA, node.name)
+                                    if node.parent:
+                                        utils.verbose_log(
+                                            err_dup, utils.AnsiColors.BOLD_YELLOW,
+                                            node.name, node.parent.name, page.name
+                                        )
+
+                                if page_children.append(page, node):
                                     node.parent = page
                             else:
                                 # << verboseBuild
-                                utils.verbose_log(err_non.format(refid), utils.AnsiColors.BOLD_RED)
+                                utils.verbose_log(err_non, utils.AnsiColors.BOLD_RED, refid)
 
                     # the location of the page as determined by doxygen
                     location = cdef.find("location")
                     if location and "file" in location.attrs:
-                        location_str = os.path.normpath(location.attrs["file"])
-                        # some older versions of doxygen don't reliably strip from path
-                        # so make sure to remove it
-                        abs_strip_path = os.path.normpath(os.path.abspath(
-                            configs.doxygenStripFromPath
-                        ))
-                        if location_str.startswith(abs_strip_path):
-                            location_str = os.path.relpath(location_str, abs_strip_path)
-                        page.location = os.path.normpath(location_str)
+                        page.location = self.strippedPath(location.attrs["file"])
 
                 except:
                     utils.fancyError(
                         "Could not process Doxygen xml for file [{0}]".format(f.name)
                     )
+            # Nothing reads the page documents after this.
+            self.releaseParsedXML([page.refid])
         self.pages = [page for page in self.pages if not page.parent]
 
         # Now that we have discovered everything, we need to explicitly parse the file
@@ -1294,18 +1829,16 @@ class ExhaleRoot(object):
         #
         # TODO: change formatting of namespace to provide a listing of all files using it
         for f in self.files:
-            node_xml_contents = utils.nodeCompoundXMLContents(f)
-            if node_xml_contents:
-                try:
-                    f.soup = BeautifulSoup(node_xml_contents, "lxml-xml")
-                except:
-                    utils.fancyError("Unable to parse file xml [{0}]:".format(f.name))
-
+            try:
+                file_soup = self.parsedCompoundXML(f)
+            except:
+                utils.fancyError("Unable to parse file xml [{0}]:".format(f.name))
+            if file_soup:
                 try:
-                    cdef = f.soup.doxygen.compounddef
+                    cdef = file_soup.doxygen.compounddef
 
                     if "language" in cdef.attrs:
-                        f.language = cdef.attrs["language"]
+                        f.language = sys.intern(cdef.attrs["language"])
 
                     err_non = "[CRITICAL] did not find refid [{0}] in `self.node_by_refid`."
                     err_dup = "Conflicting file definition: [{0}] appears to be defined in both [{1}] and [{2}]."  # noqa
@@ -1314,8 +1847,8 @@ class ExhaleRoot(object):
 
                     # << verboseBuild
                     utils.verbose_log(
-                        "*** [{0}] had [{1}] innerclasses found".format(f.name, len(inner_classes)),
-                        utils.AnsiColors.BOLD_MAGENTA
+                        "*** [{0}] had [{1}] innerclasses found", utils.AnsiColors.BOLD_MAGENTA,
+                        f.name, len(inner_classes)
                     )
 
                     for class_like in inner_classes:
@@ -1325,31 +1858,26 @@ class ExhaleRoot(object):
                                 node = self.node_by_refid[refid]
 
                                 # << verboseBuild
-                                utils.verbose_log(
-                                    "    - [{0}]".format(node.name),
-                                    utils.AnsiColors.BOLD_MAGENTA
-                                )
+                                if self.configs.verboseBuild:
+                                    utils.verbose_log("    - [{0}]", utils.AnsiColors.BOLD_MAGENTA, node.name)
 
                                 if not node.def_in_file:
                                     node.def_in_file = f
                                 elif node.def_in_file != f:
                                     # << verboseBuild
                                     utils.verbose_log(
-                                        err_dup.format(node.name, node.def_in_file.name, f.name),
-                                        utils.AnsiColors.BOLD_YELLOW
+                                        err_dup, utils.AnsiColors.BOLD_YELLOW,
+                                        node.name, node.def_in_file.name, f.name
                                     )
                             else:
                                 # << verboseBuild
-                                utils.verbose_log(err_non.format(refid), utils.AnsiColors.BOLD_RED)
+                                utils.verbose_log(err_non, utils.AnsiColors.BOLD_RED, refid)
                         else:
                             # TODO: can this ever happen?
                             # << verboseBuild
-                            catastrophe  = "CATASTROPHIC: doxygen xml for `{0}` found `innerclass` [{1}] that"
-                            catastrophe += " does *NOT* have a `refid` attribute!"
-                            catastrophe  = catastrophe.format(f, str(class_like))
                             utils.verbose_log(
-                                utils.prefix("(!) ", catastrophe),
-                                utils.AnsiColors.BOLD_RED
+                                "(!) CATASTROPHIC: doxygen xml for `{0}` found `innerclass` [{1}] that does "
+                                "*NOT* have a `refid` attribute!", utils.AnsiColors.BOLD_RED, f, class_like
                             )
 
                     # try and find anything else
@@ -1357,21 +1885,18 @@ class ExhaleRoot(object):
 
                     # << verboseBuild
                     utils.verbose_log(
-                        "*** [{0}] had [{1}] memberdef".format(f.name, len(memberdefs)),
-                        utils.AnsiColors.BOLD_MAGENTA
+                        "*** [{0}] had [{1}] memberdef", utils.AnsiColors.BOLD_MAGENTA, f.name, len(memberdefs)
                     )
 
-                    for member in cdef.find_all("memberdef", recursive=False):
+                    for member in memberdefs:
                         if "id" in member.attrs:
                             refid = member.attrs["id"]
                             if refid in self.node_by_refid:
                                 node = self.node_by_refid[refid]
 
                                 # << verboseBuild
-                                utils.verbose_log(
-                                    "    - [{0}]".format(node.name),
-                                    utils.AnsiColors.BOLD_MAGENTA
-                                )
+                                if self.configs.verboseBuild:
+                                    utils.verbose_log("    - [{0}]", utils.AnsiColors.BOLD_MAGENTA, node.name)
 
                                 if not node.def_in_file:
                                     node.def_in_file = f
@@ -1379,39 +1904,31 @@ class ExhaleRoot(object):
                     # the location of the file as determined by doxygen
                     location = cdef.find("location")
                     if location and "file" in location.attrs:
-                        location_str = os.path.normpath(location.attrs["file"])
-                        # some older versions of doxygen don't reliably strip from path
-                        # so make sure to remove it
-                        abs_strip_path = os.path.normpath(os.path.abspath(
-                            configs.doxygenStripFromPath
-                        ))
-                        if location_str.startswith(abs_strip_path):
-                            location_str = os.path.relpath(location_str, abs_strip_path)
-                        f.location = os.path.normpath(location_str)
+                        f.location = self.strippedPath(location.attrs["file"])
 
                 except:
                     utils.fancyError(
                         "Could not process Doxygen xml for file [{0}]".format(f.name)
                     )
 
+        self.files_by_location = {f.location: f for f in self.files if f.location}
+
         ###### TODO: explain how the parsing works // move it to exhale.parse
         # last chance: we will still miss some, but need to pause and establish namespace relationships
+        children = _ChildSets()
         for nspace in self.namespaces:
-            node_xml_contents = utils.nodeCompoundXMLContents(nspace)
-            if node_xml_contents:
-                try:
-                    name_soup = BeautifulSoup(node_xml_contents, "lxml-xml")
-                except:
-                    continue
-
+            try:
+                name_soup = self.parsedCompoundXML(nspace)
+            except:
+                continue
+            if name_soup:
                 cdef = name_soup.doxygen.compounddef
                 for class_like in cdef.find_all("innerclass", recursive=False):
                     if "refid" in class_like.attrs:
                         refid = class_like.attrs["refid"]
                         if refid in self.node_by_refid:
                             node = self.node_by_refid[refid]
-                            if node not in nspace.children:
-                                nspace.children.append(node)
+                            if children.append(nspace, node):
                                 node.parent = nspace
 
                 for nested_nspace in cdef.find_all("innernamespace", recursive=False):
@@ -1419,8 +1936,7 @@ class ExhaleRoot(object):
                         refid = nested_nspace.attrs["refid"]
                         if refid in self.node_by_refid:
                             node = self.node_by_refid[refid]
-                            if node not in nspace.children:
-                                nspace.children.append(node)
+                            if children.append(nspace, node):
                                 node.parent = nspace
 
                 # This is where things get interesting
@@ -1430,15 +1946,10 @@ class ExhaleRoot(object):
                             refid = memberdef.attrs["id"]
                             if refid in self.node_by_refid:
                                 node = self.node_by_refid[refid]
-                                location = memberdef.find("location")
-                                if location and "file" in location.attrs:
-                                    filedef = os.path.normpath(location.attrs["file"])
-                                    for f in self.files:
-                                        if filedef == f.location:
-                                            node.def_in_file = f
-                                            if node not in f.children:
-                                                f.children.append(node)
-                                            break
+                                f = self.fileForLocation(memberdef.find("location"))
+                                if f is not None:
+                                    node.def_in_file = f
+                                    children.append(f, node)
 
         # Find the nodes that did not have their file location definition assigned
         missing_file_def            = {} # keys: refid, values: ExhaleNode
@@ -1489,22 +2000,15 @@ class ExhaleRoot(object):
         refid_removals = []
         for refid in missing_file_def:
             node = missing_file_def[refid]
-            node_xml_contents = utils.nodeCompoundXMLContents(node)
-            # None is returned when no {refid}.xml exists (e.g., for enum or union).
-            if not node_xml_contents:
-                pass
-
             try:
-                node_soup = BeautifulSoup(node_xml_contents, "lxml-xml")
+                # None is returned when no {refid}.xml exists (e.g., for enum or union).
+                node_soup = self.parsedCompoundXML(node)
                 cdef = node_soup.doxygen.compounddef
-                location = cdef.find("location", recursive=False)
-                if location and "file" in location.attrs:
-                    file_path = os.path.normpath(location["file"])
-                    for f in self.files:
-                        if f.location == file_path:
-                            node.def_in_file = f
-                            f.children.append(node)
-                            refid_removals.append(refid)
+                f = self.fileForLocation(cdef.find("location", recursive=False))
+                if f is not None:
+                    node.def_in_file = f
+                    f.children.append(node)
+                    refid_removals.append(refid)
             except:
                 pass
 
@@ -1512,10 +2016,36 @@ class ExhaleRoot(object):
         for refid in refid_removals:
             del missing_file_def[refid]
 
+        # Members of classes (e.g., a nested enum) have no XML of their own, but the
+        # <memberdef> in the XML of their parent has a <location> just like the members
+        # of a namespace do.  Group by parent so that every parent is only visited once.
+        missing_by_parent = {}  # keys: parent ExhaleNode, values: set of refid
+        for refid in missing_file_def:
+            parent = missing_file_def[refid].parent
+            if parent is not None and parent.kind in utils.CLASS_LIKE_KINDS:
+                missing_by_parent.setdefault(parent, set()).add(refid)
+        for parent in missing_by_parent:
+            parent_soup = self.parsedCompoundXML(parent)
+            if not parent_soup:
+                continue
+            for memberdef in parent_soup.doxygen.compounddef.find_all("memberdef"):
+                refid = memberdef.attrs.get("id", None)
+                if refid in missing_by_parent[parent]:
+                    f = self.fileForLocation(memberdef.find("location", recursive=False))
+                    if f is not None:
+                        missing_file_def[refid].def_in_file = f
+                        del missing_file_def[refid]
+
         # Go through every file and see if the refid associated with a node missing a
-        # file definition location is present in the <programlisting>
+        # file definition location is present in the <programlisting>.  Only needed when
+        # the <location> is absent, and empty when ``XML_PROGRAMLISTING = NO``.
         for f in self.files:
-            cdef = f.soup.doxygen.compounddef
+            if not missing_file_def:
+                break
+            file_soup = self.parsedCompoundXML(f)
+            if not file_soup:
+                continue
+            cdef = file_soup.doxygen.compounddef
             # try and find things in the programlisting as a last resort
             programlisting = cdef.find("programlisting")
             if programlisting:
@@ -1539,14 +2069,15 @@ class ExhaleRoot(object):
             if len(candidates) == 1:
                 node.def_in_file = candidates[0]
                 # << verboseBuild
-                utils.verbose_log(utils.info(
-                    "Manually setting file definition of {0} {1} to [{2}]".format(
-                        node.kind, node.name, node.def_in_file.location
-                    ),
-                    utils.AnsiColors.BOLD_CYAN
-                ))
+                if self.configs.verboseBuild:
+                    utils.verbose_log(utils.info(
+                        "Manually setting file definition of {0} {1} to [{2}]".format(
+                            node.kind, node.name, node.def_in_file.location
+                        ),
+                        utils.AnsiColors.BOLD_CYAN
+                    ))
             # More than one found, don't know what to do...
-            elif len(candidates) > 1:
+            elif len(candidates) > 1 and self.configs.verboseBuild:
                 # << verboseBuild
                 err_msg = StringIO()
                 err_msg.write(textwrap.dedent('''
@@ -1565,15 +2096,13 @@ class ExhaleRoot(object):
         # now that all nodes have been discovered, process template parameters, and
         # coordinate any base / derived inheritance relationships
         for node in self.class_like:
-            node_xml_contents = utils.nodeCompoundXMLContents(node)
-            if node_xml_contents:
-                try:
-                    name_soup = BeautifulSoup(node_xml_contents, "lxml-xml")
-                except:
-                    utils.fancyError("Could not process [{0}]".format(
-                        os.path.join(configs._doxygen_xml_output_directory, "{0}".format(node.refid))
-                    ))
-
+            try:
+                name_soup = self.parsedCompoundXML(node)
+            except:
+                utils.fancyError("Could not process [{0}]".format(
+                    os.path.join(self.configs._doxygen_xml_output_directory, "{0}".format(node.refid))
+                ))
+            if name_soup:
                 try:
                     cdef = name_soup.doxygen.compounddef
                     tparams = cdef.find("templateparamlist", recursive=False)
@@ -1584,6 +2113,7 @@ class ExhaleRoot(object):
 
                     # first, find template parameters
                     if tparams:
+                        node.template_params = []
                         for param in tparams.find_all("param", recursive=False):
                             # Doxygen seems to produce unreliable results.  For example,
                             # sometimes you will get `param.type <- class X` with empty
@@ -1645,15 +2175,27 @@ class ExhaleRoot(object):
                         return (prot, refid, soup_node.string)
 
                     # Now see if there is a reference to any base classes
-                    for base in cdef.find_all("basecompoundref", recursive=False):
-                        node.base_compounds.append(prot_ref_str(base))
+                    bases = [prot_ref_str(b) for b in cdef.find_all("basecompoundref", recursive=False)]
+                    if bases:
+                        node.base_compounds = bases
 
                     # Now see if there is a reference to any derived classes
-                    for derived in cdef.find_all("derivedcompoundref", recursive=False):
-                        node.derived_compounds.append(prot_ref_str(derived))
+                    derived = [prot_ref_str(d) for d in cdef.find_all("derivedcompoundref", recursive=False)]
+                    if derived:
+                        node.derived_compounds = derived
                 except:
                     utils.fancyError("Error processing Doxygen XML for [{0}]".format(node.name), "txt")
 
+        # Only parseFunctionSignatures (the functions) and parse.getBriefAndDetailedRST
+        # (the descriptions) read the file and namespace documents again, nothing reads
+        # the others.
+        retained = set(n.refid for n in itertools.chain(self.files, self.namespaces))
+        for refid in list(self.parsed_xml):
+            if refid in retained:
+                self.retainParsedXML(refid, _isFunctionOrDescription)
+            else:
+                self.releaseParsedXML([refid])
+
     def trackNodeIfUnseen(self, node):
         '''
         Helper method for :func:`~exhale.graph.ExhaleRoot.discoverAllNodes`.  If the node
@@ -1664,38 +2206,18 @@ class ExhaleRoot(object):
             ``node`` (ExhaleNode)
                 The node to begin tracking if not already present.
         '''
-        if node not in self.all_nodes:
+        # Every node is tracked with the refid, identity is checked since the members of
+        # both a file and a namespace are discovered (as distinct nodes) for each.
+        if self.node_by_refid.get(node.refid) is not node:
             node.set_owner(self)
             self.all_nodes.append(node)
             self.node_by_refid[node.refid] = node
-            if node.kind == "class" or node.kind == "struct":
-                self.class_like.append(node)
-            elif node.kind == "namespace":
-                self.namespaces.append(node)
-            elif node.kind == "enum":
-                self.enums.append(node)
-            elif node.kind == "enumvalue":
-                self.enum_values.append(node)
-            elif node.kind == "define":
-                self.defines.append(node)
-            elif node.kind == "file":
-                self.files.append(node)
-            elif node.kind == "dir":
-                self.dirs.append(node)
-            elif node.kind == "function":
-                self.functions.append(node)
-            elif node.kind == "variable":
-                self.variables.append(node)
-            elif node.kind == "group":
-                self.groups.append(node)
-            elif node.kind == "typedef":
-                self.typedefs.append(node)
-            elif node.kind == "union":
-                self.unions.append(node)
-            elif node.kind == "page":
-                self.pages.append(node)
-                if node.refid != "indexpage":
-                    self.index_xml_page_ordering.append(node)
+            root_list = utils.KIND_ROOT_LISTS[node.kind_code]
+            if root_list is not None:
+                getattr(self, root_list).append(node)
+            if node.kind_code == utils.Kind.PAGE and node.refid != "indexpage":
+                self.index_xml_page_rank[node.refid] = len(self.index_xml_page_ordering)
+                self.index_xml_page_ordering.append(node)
 
     def reparentAll(self):
         '''
@@ -1710,19 +2232,26 @@ class ExhaleRoot(object):
         4. :func:`~exhale.graph.ExhaleRoot.renameToNamespaceScopes`
         5. :func:`~exhale.graph.ExhaleRoot.reparentNamespaces`
         '''
-        self.reparentUnions()
-        self.reparentClassLike()
-        self.reparentDirectories()
-        self.renameToNamespaceScopes()
+        with self.metrics.phase("reparentUnions"):
+            self.reparentUnions()
+        with self.metrics.phase("reparentClassLike"):
+            self.reparentClassLike()
+        with self.metrics.phase("reparentDirectories"):
+            self.reparentDirectories()
+        with self.metrics.phase("renameToNamespaceScopes"):
+            self.renameToNamespaceScopes()
 
         # NOTE: must be last in current setup, reparenting of unions and class_like
         # relies on self.namespaces having all namespaces in self.namespaces, after this
         # nested namespaces are not in self.namespaces.
-        self.reparentNamespaces()
+        with self.metrics.phase("reparentNamespaces"):
+            self.reparentNamespaces()
 
-        # make sure all children lists are unique (no duplicate children)
+        # make sure all children lists are unique (no duplicate children), keeping the
+        # order found so that generated documents are identical between builds
         for node in self.all_nodes:
-            node.children = list(set(node.children))
+            if len(node.children) > 1:
+                node.children = list(dict.fromkeys(node.children))
 
     def reparentUnions(self):
         '''
@@ -1736,33 +2265,31 @@ class ExhaleRoot(object):
         '''
         # unions declared in a class will not link to the individual union page, so
         # we will instead elect to remove these from the list of unions
-        removals = []
+        scopes = {}
+        for node in itertools.chain(self.class_like, self.namespaces):
+            scopes.setdefault(node.name, node)
+
+        removals = set()
         for u in self.unions:
-            parts = u.name.split("::")
-            if len(parts) >= 2:
+            parent_name = utils.parentScope(u.name)
+            if parent_name is not None:
                 # TODO: nested unions are not supported right now...
-                parent_name = "::".join(p for p in parts[:-1])
-                reparented  = False
                 # see if the name matches any potential parents
-                for node in itertools.chain(self.class_like, self.namespaces):
-                    if node.name == parent_name:
-                        node.children.append(u)
-                        u.parent = node
-                        reparented = True
-                        break
-                # if not reparented, try the namespaces
-                if reparented:
-                    removals.append(u)
+                node = scopes.get(parent_name, None)
+                if node is not None:
+                    node.children.append(u)
+                    u.parent = node
+                    removals.add(u)
                 else:
                     # << verboseBuild
                     utils.verbose_log(
-                        "The union {0} has '::' in its name, but no parent was found!".format(u.name),
-                        utils.AnsiColors.BOLD_RED
+                        "The union {0} has '::' in its name, but no parent was found!",
+                        utils.AnsiColors.BOLD_RED, u.name
                     )
 
         # remove the unions from self.unions that were declared in class_like objects
-        for rm in removals:
-            self.unions.remove(rm)
+        if removals:
+            self.unions = [u for u in self.unions if u not in removals]
 
     def reparentClassLike(self):
         '''
@@ -1774,31 +2301,33 @@ class ExhaleRoot(object):
         is a nested class / struct), it *will* be removed from so that the class view
         hierarchy is generated correctly.
         '''
-        removals = []
+        class_like_by_name = {}
         for cl in self.class_like:
-            parts = cl.name.split("::")
-            if len(parts) > 1:
-                parent_name = "::".join(parts[:-1])
+            class_like_by_name.setdefault(cl.name, cl)
+        namespaces_by_name = {}
+        for nspace in self.namespaces:
+            namespaces_by_name.setdefault(nspace.name, nspace)
 
+        removals = set()
+        for cl in self.class_like:
+            parent_name = utils.parentScope(cl.name)
+            if parent_name is not None:
                 # Try and reparent to class_like first.  If it is a nested class then
                 # we remove from the top level self.class_like.
-                for parent_cl in self.class_like:
-                    if parent_cl.name == parent_name:
-                        parent_cl.children.append(cl)
-                        cl.parent = parent_cl
-                        removals.append(cl)
-                        break
+                parent_cl = class_like_by_name.get(parent_name, None)
+                if parent_cl is not None:
+                    parent_cl.children.append(cl)
+                    cl.parent = parent_cl
+                    removals.add(cl)
 
                 # Next, reparent to namespaces.  Do not delete from self.class_like.
-                for parent_nspace in self.namespaces:
-                    if parent_nspace.name == parent_name:
-                        parent_nspace.children.append(cl)
-                        cl.parent = parent_nspace
-                        break
+                parent_nspace = namespaces_by_name.get(parent_name, None)
+                if parent_nspace is not None:
+                    parent_nspace.children.append(cl)
+                    cl.parent = parent_nspace
 
-        for rm in removals:
-            if rm in self.class_like:
-                self.class_like.remove(rm)
+        if removals:
+            self.class_like = [cl for cl in self.class_like if cl not in removals]
 
     def reparentDirectories(self):
         '''
@@ -1807,33 +2336,28 @@ class ExhaleRoot(object):
         ``self.dirs`` is added as a child to a different directory node, it is removed
         from the ``self.dirs`` list.
         '''
-        dir_parts = []
-        dir_ranks = []
-        for d in self.dirs:
-            parts = d.name.split(os.sep)
-            for p in parts:
-                if p not in dir_parts:
-                    dir_parts.append(p)
-            dir_ranks.append((len(parts), d))
+        dir_ranks = [(d.name.count(os.sep) + 1, d) for d in self.dirs]
 
         traversal = sorted(dir_ranks)
-        removals = []
+        # the first directory of each (rank, name) in the order they are traversed
+        dirs_by_rank_name = {}
+        for rank, directory in reversed(traversal):
+            dirs_by_rank_name.setdefault((rank, directory.name), directory)
+
+        removals = set()
         for rank, directory in reversed(traversal):
             # rank one means top level directory
             if rank < 2:
                 break
             # otherwise, this is nested
-            for p_rank, p_directory in reversed(traversal):
-                if p_rank == rank - 1:
-                    if p_directory.name == os.path.dirname(directory.name):
-                        p_directory.children.append(directory)
-                        directory.parent = p_directory
-                        if directory not in removals:
-                            removals.append(directory)
-                        break
+            p_directory = dirs_by_rank_name.get((rank - 1, os.path.dirname(directory.name)), None)
+            if p_directory is not None:
+                p_directory.children.append(directory)
+                directory.parent = p_directory
+                removals.add(directory)
 
-        for rm in removals:
-            self.dirs.remove(rm)
+        if removals:
+            self.dirs = [d for d in self.dirs if d not in removals]
 
     def renameToNamespaceScopes(self):
         '''
@@ -1863,38 +2387,27 @@ class ExhaleRoot(object):
         :func:`~exhale.graph.ExhaleRoot.renameToNamespaceScopes` is called before this
         method.
         '''
-        namespace_parts = []
-        namespace_ranks = []
-        for n in self.namespaces:
-            parts = n.name.split("::")
-            for p in parts:
-                if p not in namespace_parts:
-                    namespace_parts.append(p)
-            namespace_ranks.append((len(parts), n))
+        namespace_ranks = [(n.name.count("::") + 1, n) for n in self.namespaces]
 
         traversal = sorted(namespace_ranks)
-        removals = []
+        # every namespace with a given name, in the order they are traversed
+        namespaces_by_name = {}
+        for rank, namespace in reversed(traversal):
+            namespaces_by_name.setdefault(namespace.name, []).append(namespace)
+
         for rank, namespace in reversed(traversal):
             # rank one means top level namespace
             if rank < 2:
                 continue
             # otherwise, this is nested
-            for p_rank, p_namespace in reversed(traversal):
-                if p_rank == rank - 1:
-                    if p_namespace.name == "::".join(namespace.name.split("::")[:-1]):
-                        p_namespace.children.append(namespace)
-                        namespace.parent = p_namespace
-                        if namespace not in removals:
-                            removals.append(namespace)
-                        continue
-
-        removals = []
-        for nspace in self.namespaces:
-            if nspace.parent and nspace.parent.kind == "namespace" and nspace not in removals:
-                removals.append(nspace)
+            for p_namespace in namespaces_by_name.get(utils.parentScope(namespace.name), ()):
+                p_namespace.children.append(namespace)
+                namespace.parent = p_namespace
 
-        for rm in removals:
-            self.namespaces.remove(rm)
+        self.namespaces = [
+            nspace for nspace in self.namespaces
+            if not (nspace.parent and nspace.parent.kind == "namespace")
+        ]
 
     def fileRefDiscovery(self):
         '''
@@ -1912,14 +2425,17 @@ class ExhaleRoot(object):
         .. warning::
             Some enums, classes, variables, etc declared in the file will not have their
             associated refid in the declaration of the file, but will be present in the
-            <programlisting>.  These are added to the files' list of children when they
-            are found, but this parental relationship cannot be formed if you set
-            ``XML_PROGRAMLISTING = NO`` with Doxygen.  An example of such an enum would
-            be an enum declared inside of a namespace within this file.
+            <programlisting>.  An example of such an enum would be an enum declared
+            inside of a namespace within this file.  These are added to the files' list of
+            children using the ``<location>`` of their ``<memberdef>``, the
+            <programlisting> is only searched for items without one.  So this parental
+            relationship can still be formed with ``XML_PROGRAMLISTING = NO``, see
+            :data:`~exhale.configs.exhaleDoxygenLean`.
         '''
-        if not os.path.isdir(configs._doxygen_xml_output_directory):
+        xml_dir = self.configs._doxygen_xml_output_directory
+        if not os.path.isdir(xml_dir) and utils.doxygenXMLArchive(self.configs) is None:
             utils.fancyError("The doxygen xml output directory [{0}] is not valid!".format(
-                configs._doxygen_xml_output_directory
+                self.configs._doxygen_xml_output_directory
             ))
 
         # parse the doxygen xml file and extract all refid's put in it
@@ -1936,45 +2452,52 @@ class ExhaleRoot(object):
 
         for f in self.files:
             doxygen_xml_file_ownerships[f] = []
+            includes = []
+            included_by = []
+            program_listing = []
             try:
-                doxy_xml_path = os.path.join(configs._doxygen_xml_output_directory, "{0}.xml".format(f.refid))
-                with codecs.open(doxy_xml_path, "r", "utf-8") as doxy_file:
-                    processing_code_listing = False  # shows up at bottom of xml
-                    for line in doxy_file:
-                        # see if this line represents the location tag
-                        match = loc_regex.match(line)
+                doxy_xml_contents = self.compoundXMLContents(f)
+                if doxy_xml_contents is None:
+                    raise IOError("No XML document for [{0}].".format(f.refid))
+                processing_code_listing = False  # shows up at bottom of xml
+                for line in doxy_xml_contents.splitlines(True):
+                    # see if this line represents the location tag
+                    match = loc_regex.match(line)
+                    if match is not None:
+                        f.location = os.path.normpath(match.groups()[0])
+                        continue
+
+                    if not processing_code_listing:
+                        # gather included by references
+                        match = inc_by_regex.match(line)
                         if match is not None:
-                            f.location = os.path.normpath(match.groups()[0])
+                            ref, name = match.groups()
+                            included_by.append((ref, name))
                             continue
-
-                        if not processing_code_listing:
-                            # gather included by references
-                            match = inc_by_regex.match(line)
-                            if match is not None:
-                                ref, name = match.groups()
-                                f.included_by.append((ref, name))
-                                continue
-                            # gather includes lines
-                            match = inc_regex.match(line)
-                            if match is not None:
-                                inc = match.groups()[0]
-                                f.includes.append(inc)
-                                continue
-                            # gather any classes, namespaces, etc declared in the file
-                            match = ref_regex.match(line)
-                            if match is not None:
-                                match_refid = match.groups()[0]
-                                if match_refid in self.node_by_refid:
-                                    doxygen_xml_file_ownerships[f].append(match_refid)
-                                continue
-                            # lastly, see if we are starting the code listing
-                            if "<programlisting>" in line:
-                                processing_code_listing = True
-                        elif processing_code_listing:
-                            if "</programlisting>" in line:
-                                processing_code_listing = False
-                            else:
-                                f.program_listing.append(line)
+                        # gather includes lines
+                        match = inc_regex.match(line)
+                        if match is not None:
+                            inc = match.groups()[0]
+                            includes.append(inc)
+                            continue
+                        # gather any classes, namespaces, etc declared in the file
+                        match = ref_regex.match(line)
+                        if match is not None:
+                            match_refid = match.groups()[0]
+                            if match_refid in self.node_by_refid:
+                                doxygen_xml_file_ownerships[f].append(match_refid)
+                            continue
+                        # lastly, see if we are starting the code listing
+                        if "<programlisting>" in line:
+                            processing_code_listing = True
+                    elif processing_code_listing:
+                        if "</programlisting>" in line:
+                            processing_code_listing = False
+                        else:
+                            program_listing.append(line)
+                f.includes = self.storage.sequence("includes", f.refid, includes)
+                f.included_by = self.storage.sequence("included_by", f.refid, included_by)
+                f.program_listing = self.storage.sequence("program_listing", f.refid, program_listing)
             except:
                 utils.fancyError(
                     "Unable to process doxygen xml for file [{0}].\n".format(f.name)
@@ -1986,56 +2509,73 @@ class ExhaleRoot(object):
 
         # hack to make things work right on RTD
         # TODO: do this at construction rather than as a post process!
-        if configs.doxygenStripFromPath is not None:
+        if self.configs.doxygenStripFromPath is not None:
             for node in itertools.chain(self.files, self.dirs):
                 if node.kind == "file":
-                    manip = node.location
-                else:  # node.kind == "dir"
-                    manip = node.name
-
-                abs_strip_path = os.path.normpath(os.path.abspath(
-                    configs.doxygenStripFromPath
-                ))
-                if manip.startswith(abs_strip_path):
-                    manip = os.path.relpath(manip, abs_strip_path)
-
-                manip = os.path.normpath(manip)
-                if node.kind == "file":
-                    node.location = manip
+                    node.location = self.strippedPath(node.location)
                 else:  # node.kind == "dir"
-                    node.name = manip
+                    node.name = self.strippedPath(node.name)
 
         # now that we have parsed all the listed refid's in the doxygen xml, reparent
         # the nodes that we care about
-        allowable_child_kinds = ["struct", "class", "function", "typedef", "define", "enum", "union"]
+        allowable_child_kinds = {"struct", "class", "function", "typedef", "define", "enum", "union"}
+        children = _ChildSets()
+        namespaces_used = _ChildSets("namespaces_used")
         for f in self.files:
             for match_refid in doxygen_xml_file_ownerships[f]:
                 child = self.node_by_refid[match_refid]
                 if child.kind in allowable_child_kinds:
-                    if child not in f.children:
-                        f.children.append(child)
+                    children.append(f, child)
                 elif child.kind == "namespace":
-                    if child not in f.namespaces_used:
-                        f.namespaces_used.append(child)
+                    namespaces_used.append(f, child)
 
         # last but not least, some different kinds declared in the file that are scoped
         # in a namespace they will show up in the programlisting, but not at the toplevel.
+        # The children of every namespace a file uses are potential orphans of the file
+        # they were defined in, or of a file whose refid their refid starts with (e.g.
+        # n0_2header0_8hpp_1a...) when the listing of that file names them.  Indexing
+        # them by file, and then by name, visits every child and scans every listing
+        # once.
+        orphan_kinds = {"enum", "variable", "function", "typedef", "union"}
+        files_by_refid = {f.refid: f for f in self.files}
+        defined_orphans = {}  # keys: file, values: list of (namespace, orphan)
+        named_orphans = {}    # keys: file, values: {name: list of (namespace, orphan)}
+        used = {}
         for f in self.files:
-            potential_orphans = []
             for n in f.namespaces_used:
-                for child in n.children:
-                    if child.kind == "enum"     or child.kind == "variable" or \
-                       child.kind == "function" or child.kind == "typedef"  or \
-                       child.kind == "union":
-                        potential_orphans.append(child)
-
-            # now that we have a list of potential orphans, see if this doxygen xml had
-            # the refid of a given child present.
-            for orphan in potential_orphans:
-                unresolved_name = orphan.name.split("::")[-1]
-                if f.refid in orphan.refid and any(unresolved_name in line for line in f.program_listing):
-                    if orphan not in f.children:
-                        f.children.append(orphan)
+                used[n] = True
+        for n in used:
+            for child in n.children:
+                if child.kind not in orphan_kinds:
+                    continue
+                if child.def_in_file is not None:
+                    defined_orphans.setdefault(child.def_in_file, []).append((n, child))
+                start = child.refid.find("_1")
+                while start > 0:
+                    owner = files_by_refid.get(child.refid[:start], None)
+                    if owner is not None and owner is not child.def_in_file:
+                        named_orphans.setdefault(owner, {}).setdefault(
+                            child.name.split("::")[-1], []
+                        ).append((n, child))
+                    start = child.refid.find("_1", start + 2)
+
+        for f in self.files:
+            if f not in defined_orphans and f not in named_orphans:
+                continue
+            namespaces_used = set(f.namespaces_used)
+            for n, orphan in defined_orphans.get(f, ()):
+                if n in namespaces_used:
+                    children.append(f, orphan)
+            by_name = named_orphans.get(f, None)
+            if by_name:
+                listing = "".join(f.program_listing)
+                identifiers = set(_IDENTIFIER_REGEX.findall(listing))
+                for name in by_name:
+                    # e.g. operator names are not identifiers, search for those instead
+                    if name in identifiers or (not _IDENTIFIER_REGEX.fullmatch(name) and name in listing):
+                        for n, orphan in by_name[name]:
+                            if n in namespaces_used:
+                                children.append(f, orphan)
 
         # Last but not least, make sure all children know where they were defined.
         for f in self.files:
@@ -2045,10 +2585,8 @@ class ExhaleRoot(object):
                 elif child.def_in_file != f:
                     # << verboseBuild
                     utils.verbose_log(
-                        "Conflicting file definition for [{0}]: both [{1}] and [{2}] found.".format(
-                            child.name, child.def_in_file.name, f.name
-                        ),
-                        utils.AnsiColors.BOLD_RED
+                        "Conflicting file definition for [{0}]: both [{1}] and [{2}] found.",
+                        utils.AnsiColors.BOLD_RED, child.name, child.def_in_file.name, f.name
                     )
 
     def filePostProcess(self):
@@ -2072,40 +2610,37 @@ class ExhaleRoot(object):
                     nodes_remaining.append(child)
 
         all_directories.sort()
+        # The first (sorted) directory of every name.
+        directory_by_name = {}
+        for d in all_directories:
+            directory_by_name.setdefault(d.name, d)
 
         for f in self.files:
             if not f.location:
-                sys.stderr.write(utils.critical(
-                    "Cannot reparent file [{0}] because it's location was not discovered.\n".format(
+                logger.warning(utils.critical(
+                    "Cannot reparent file [{0}] because it's location was not discovered.".format(
                         f.name
                     )
-                ))
+                ), type="exhale", subtype="file_location")
                 continue
             elif os.sep not in f.location:
                 # top-level file, cannot parent do a directory
                 utils.verbose_log(
-                    "### File [{0}] with location [{1}] was identified as being at the top level".format(
-                        f.name, f.location
-                    ),
-                    utils.AnsiColors.BOLD_YELLOW
+                    "### File [{0}] with location [{1}] was identified as being at the top level",
+                    utils.AnsiColors.BOLD_YELLOW, f.name, f.location
                 )
                 continue
 
-            dirname = os.path.dirname(f.location)
-            found = False
-            for d in all_directories:
-                if dirname == d.name:
-                    d.children.append(f)
-                    f.parent = d
-                    found = True
-                    break
-
-            if not found:
-                sys.stderr.write(utils.critical(
-                    "Could not find directory parent of file [{0}] with location [{1}].\n".format(
+            d = directory_by_name.get(os.path.dirname(f.location), None)
+            if d is not None:
+                d.children.append(f)
+                f.parent = d
+            else:
+                logger.warning(utils.critical(
+                    "Could not find directory parent of file [{0}] with location [{1}].".format(
                         f.name, f.location
                     )
-                ))
+                ), type="exhale", subtype="file_location")
 
     def parseFunctionSignatures(self):
         """Search file and namespace node XML contents for function signatures."""
@@ -2131,11 +2666,13 @@ class ExhaleRoot(object):
             elif func.def_in_file:
                 parent_refid = func.def_in_file.refid
             else:
-                utils.verbose_log(utils.critical(
-                    "Cannot parse function [{0}] signature, refid=[{2}], no parent/def_in_file found!".format(
-                        func.name, func.refid
-                    )
-                ))
+                parent_refid = None
+                # << verboseBuild
+                if self.configs.verboseBuild:
+                    utils.verbose_log(utils.critical(
+                        "Cannot parse function [{0}] signature, refid=[{1}], no parent/def_in_file "
+                        "found!".format(func.name, func.refid)
+                    ))
 
             # If we found a suitable parent refid, gather in parent_to_func.
             if parent_refid:
@@ -2148,14 +2685,12 @@ class ExhaleRoot(object):
         # TODO: setwise comparison / report when children vs parent_to_func[refid] differ?
         for refid in parent_to_func:
             parent = self.node_by_refid[refid]
-            parent_contents = utils.nodeCompoundXMLContents(parent)
-            if not parent_contents:
-                continue  ############flake8efphase: TODO: error, log?
-
             try:
-                parent_soup = BeautifulSoup(parent_contents, "lxml-xml")
+                parent_soup = self.parsedCompoundXML(parent)
             except:
                 continue
+            if not parent_soup:
+                continue  ############flake8efphase: TODO: error, log?
 
             cdef = parent_soup.doxygen.compounddef
             func_section = None
@@ -2197,15 +2732,23 @@ class ExhaleRoot(object):
                 parameters = []
                 for param in memberdef.find_all("param", recursive=False):
                     parameters.append(param.type.text)
-                func.parameters = utils.sanitize_all(parameters)
+                func.parameters = self.storage.sequence(
+                    "parameters", func.refid, utils.sanitize_all(parameters)
+                )
                 # 3. The template parameter list.
                 templateparamlist = memberdef.templateparamlist
                 if templateparamlist:
                     template = []
                     for param in templateparamlist.find_all("param", recursive=False):
                         template.append(param.type.text)
-                    func.template = utils.sanitize_all(template)
+                    func.template = self.storage.sequence("template", func.refid, utils.sanitize_all(template))
+
+            # Done with the functions of this parent.
+            func_section.decompose()
 
+        # Only the descriptions of the file and namespace documents are read again.
+        for refid in list(self.parsed_xml):
+            self.retainParsedXML(refid, _isDescription)
 
     def sortInternals(self):
         '''
@@ -2287,14 +2830,82 @@ class ExhaleRoot(object):
         # after node documents are generated due to bad design (link names and other
         # items get initialized).  Or at least that's what I remember.
         skip_root = self.root_file_name == "EXCLUDE"
-        if not skip_root:
-            self.generateAPIRootHeader()
-        self.generateNodeDocuments()
-        self.gerrymanderNodeFilenames()
-        self.generateViewHierarchies()
-        self.generateUnabridgedAPI()
-        if not skip_root:
-            self.generateAPIRootBody()
+        with self.metrics.phase("generateFullAPI"):
+            if not skip_root:
+                with self.metrics.phase("generateAPIRootHeader"):
+                    self.generateAPIRootHeader()
+            with self.metrics.phase("generateNodeDocuments"):
+                self.generateNodeDocuments()
+            with self.metrics.phase("gerrymanderNodeFilenames"):
+                self.gerrymanderNodeFilenames()
+            with self.metrics.phase("generateViewHierarchies"):
+                self.generateViewHierarchies()
+            with self.metrics.phase("generateUnabridgedAPI"):
+                self.generateUnabridgedAPI()
+            if not skip_root:
+                with self.metrics.phase("generateAPIRootBody"):
+                    self.generateAPIRootBody()
+            if self.configs.contentStoreDirectory:
+                with self.metrics.phase("publishContentStore"):
+                    self.publishContentStore()
+
+    def generatedDocuments(self):
+        '''
+        Gather the documents written by :func:`~exhale.graph.ExhaleRoot.generateFullAPI`.
+
+        :Return (list):
+            The sorted absolute paths of every generated document that exists.
+        '''
+        # After generation, node.file_name (and program_file) are basenames.  See
+        # ExhaleRoot.gerrymanderNodeFilenames.
+        candidates = {
+            self.full_root_file_path,
+            self.page_hierarchy_file,
+            self.class_hierarchy_file,
+            self.file_hierarchy_file,
+            self.unabridged_api_file,
+            self.unabridged_orphan_file
+        }
+        for node in self.all_nodes:
+            if node.file_name:
+                candidates.add(os.path.join(self.root_directory, node.file_name))
+            if node.kind == "file" and node.program_file:
+                candidates.add(os.path.join(self.root_directory, node.program_file))
+        return sorted(path for path in candidates if os.path.isfile(path))
+
+    def publishContentStore(self):
+        '''
+        Move every generated document into :data:`~exhale.configs.contentStoreDirectory`
+        (see :func:`~exhale.utils.storeDocument`), and write the manifest mapping each
+        document path relative to ``self.root_directory`` to its ``sha256``.  The manifest
+        of the previous build decides which documents changed.
+        '''
+        start = utils.get_time()
+        manifest = {}
+        try:
+            manifest_path = os.path.join(self.root_directory, "exhale_manifest.json")
+            previous = {}
+            if os.path.isfile(manifest_path):
+                with codecs.open(manifest_path, "r", "utf-8") as previous_manifest:
+                    previous = json.load(previous_manifest).get("documents", {})
+            for path in self.generatedDocuments():
+                relative = os.path.relpath(path, self.root_directory).replace(os.sep, "/")
+                manifest[relative] = utils.storeDocument(
+                    path, self.configs.contentStoreDirectory, previous.get(relative, None)
+                )
+            utils.writeIfChanged(manifest_path, json.dumps(
+                {"algorithm": "sha256", "documents": manifest}, indent=2, sort_keys=True
+            ) + "\n")
+        except:
+            utils.fancyError("Unable to publish to the content store [{0}].".format(
+                self.configs.contentStoreDirectory
+            ))
+        end = utils.get_time()
+        # << verboseBuild
+        utils.verbose_log(
+            "Stored {0} documents in [{1}] in {2}", None,
+            len(manifest), self.configs.contentStoreDirectory, utils.time_string(start, end)
+        )
 
     def generateAPIRootHeader(self):
         '''
@@ -2304,27 +2915,27 @@ class ExhaleRoot(object):
         ``configs.afterTitleDescription``.
         '''
         try:
-            with codecs.open(self.full_root_file_path, "w", "utf-8") as generated_index:
+            with self.openGeneratedDocument(self.full_root_file_path) as generated_index:
                 # Add the metadata if they requested it
-                if configs.pageLevelConfigMeta:
-                    generated_index.write("{0}\n\n".format(configs.pageLevelConfigMeta))
+                if self.configs.pageLevelConfigMeta:
+                    generated_index.write("{0}\n\n".format(self.configs.pageLevelConfigMeta))
 
-                if configs.rootFileTitle:
+                if self.configs.rootFileTitle:
                     generated_index.write(textwrap.dedent('''\
                         {heading_mark}
                         {heading}
                         {heading_mark}
 
                     '''.format(
-                        heading=configs.rootFileTitle,
+                        heading=self.configs.rootFileTitle,
                         heading_mark=utils.heading_mark(
-                            configs.rootFileTitle,
+                            self.configs.rootFileTitle,
                             configs.SECTION_HEADING_CHAR
                         )
                     )))
 
-                if configs.afterTitleDescription:
-                    generated_index.write("\n{0}\n\n".format(configs.afterTitleDescription))
+                if self.configs.afterTitleDescription:
+                    generated_index.write("\n{0}\n\n".format(self.configs.afterTitleDescription))
         except:
             utils.fancyError(
                 "Unable to create the root api file / header: {0}".format(self.full_root_file_path)
@@ -2358,23 +2969,229 @@ class ExhaleRoot(object):
         ``self.unions``.
         '''
         # initialize all of the nodes first
-        for node in self.all_nodes:
-            self.initializeNodeFilenameAndLink(node)
+        with self.metrics.phase("initializeNodeFilenameAndLink"):
+            for node in self.all_nodes:
+                self.initializeNodeFilenameAndLink(node)
+
+        with self.metrics.phase("adjustFunctionTitles"):
+            self.adjustFunctionTitles()
 
-        self.adjustFunctionTitles()
+        # only placeholders are written now, see renderOnDemandDocument
+        if self.configs.onDemandGeneration:
+            with self.metrics.phase("deferNodeDocuments"):
+                self.deferNodeDocuments()
+            # Sphinx may fork read workers now, they only see what was committed.
+            self.storage.commit()
+            return
 
         # now that all potential ``node.link_name`` members are initialized, generate
         # the leaf-like documents
-        for node in self.all_nodes:
-            if node.kind in utils.LEAF_LIKE_KINDS:
-                self.generateSingleNodeRST(node)
+        with self.metrics.phase("generateSingleNodeRST"):
+            for node in self.all_nodes:
+                if utils.KIND_IS_LEAF_LIKE[node.kind_code]:
+                    with self.metrics.compound(node, "generate"):
+                        self.generateSingleNodeRST(node)
 
-        self.generatePageDocuments()
+        with self.metrics.phase("generatePageDocuments"):
+            self.generatePageDocuments()
 
         # generate the remaining parent-like documents
-        self.generateNamespaceNodeDocuments()
-        self.generateFileNodeDocuments()
-        self.generateDirectoryNodeDocuments()
+        with self.metrics.phase("generateNamespaceNodeDocuments"):
+            self.generateNamespaceNodeDocuments()
+        with self.metrics.phase("generateFileNodeDocuments"):
+            self.generateFileNodeDocuments()
+        with self.metrics.phase("generateDirectoryNodeDocuments"):
+            self.generateDirectoryNodeDocuments()
+
+        # Every document is written, nothing reads the Doxygen XML after this.
+        self.releaseParsedXML(list(self.parsed_xml))
+        if self.combined_xml is not None:
+            self.combined_xml.close()
+
+    @contextlib.contextmanager
+    def openGeneratedDocument(self, path, mode="w"):
+        '''
+        Open the generated document ``path`` for writing.  Every document generator
+        writes through this method so that the same code can either write to disk or, in
+        :func:`~exhale.graph.ExhaleRoot.renderOnDemandDocument`, to memory.  Documents
+        hard linked into :data:`~exhale.configs.contentStoreDirectory` are detached
+        first, so that the stored object is never modified.
+
+        :Parameters:
+            ``path`` (str)
+                The path of the document, e.g. ``node.file_name``.
+
+            ``mode`` (str)
+                Either ``"w"`` or ``"a"``.
+
+        :Return (file-like):
+            The open ``utf-8`` file, or the in-memory stream currently being rendered.
+        '''
+        if self._render_stream is not None:
+            yield self._render_stream
+        else:
+            utils.detachSharedFile(path, keep_contents=mode == "a")
+            with codecs.open(path, mode, "utf-8") as gen_file:
+                start = gen_file.tell()
+                yield gen_file
+                metrics.count("bytes_written", gen_file.tell() - start)
+            if mode == "w":
+                metrics.count("pages_written")
+
+    def deferNodeDocuments(self):
+        '''
+        Used instead of generating the node documents when
+        :data:`~exhale.configs.onDemandGeneration` is ``True``.  For every document that
+        :func:`~exhale.graph.ExhaleRoot.generateNodeDocuments` would create, records
+        the generator in ``self.on_demand_documents`` by Sphinx docname, and writes a
+        placeholder for Sphinx to discover.
+
+        The placeholder contains a fingerprint of what the page renders: the Doxygen XML
+        the node was parsed from, the titles and links of the nodes it shows (parent,
+        children, includes, etc.), the links to other projects, and the Exhale version and
+        configuration (see :func:`~exhale.configs.generationFingerprint`).  It is only
+        rewritten when the fingerprint changes.  Unmodified placeholders keep their modification time, so
+        Sphinx will not re-read (or ask Exhale to render) them.
+        '''
+        generators = {
+            "dir":       self.generateDirectoryNodeRST,
+            "file":      self.generateSingleFileNodeDocument,
+            "namespace": self.generateSingleNamespace,
+            "page":      self.generateSinglePageDocument
+        }
+        for kind in utils.LEAF_LIKE_KINDS:
+            generators[kind] = self.generateSingleNodeRST
+
+        fingerprints = {}
+        shared = configs.generationFingerprint(self.configs) + json.dumps(self.project_links, sort_keys=True)
+        for node in self.all_nodes:
+            generate = generators.get(node.kind, None)
+            if generate is None:
+                continue
+
+            # These titles are otherwise assigned while generating, the hierarchies
+            # need them.  See generateSingleNamespace / generateSingleFileNodeDocument.
+            if node.kind in ["file", "namespace"]:
+                node.title = "{0} {1}".format(utils.qualifyKind(node.kind), node.name)
+
+            documents = [(generate, node.file_name)]
+            if node.kind == "file" and len(node.program_listing) > 0:
+                documents.append((self.generateSingleFileProgramListing, node.program_file))
+
+            for generate, path in documents:
+                # e.g. the `indexpage` is .. include::'ed, Sphinx never reads it.
+                if not path.endswith(".rst"):
+                    generate(node)
+                    continue
+
+                docname = utils.sphinxDocname(path, self.configs)
+                self.on_demand_documents[docname] = (generate, node)
+                fingerprint = self._page_fingerprint(node, shared, fingerprints)
+                placeholder = ".. exhale: generated on demand ({0}).\n".format(fingerprint)
+                utils.writeIfChanged(path, placeholder)
+
+    def _page_fingerprint(self, node, shared, cache):
+        # Everything the page of ``node`` shows: the node and the titles and links of its
+        # parent, children, where it is defined, includes and included by, bases and
+        # derived, and the Doxygen XML it is rendered from.  Nothing else on another page
+        # changes it, so editing one compound only rewrites the placeholders linking it.
+        related = [node, node.parent, node.def_in_file] + list(node.children)
+        if node.kind == "file":
+            related += list(node.namespaces_used)
+            related += [self.node_by_refid.get(ref, None) for ref, _ in node.included_by]
+        for ref in list(node.base_compounds) + list(node.derived_compounds):
+            related += [self.node_by_refid.get(str(part), None) for part in ref]
+
+        sha1 = hashlib.sha1(shared.encode("utf-8"))
+        sha1.update(self._source_fingerprint(node, cache).encode("utf-8"))
+        for related_node in related:
+            if related_node is not None:
+                sha1.update(repr(self._node_fields(related_node)).encode("utf-8"))
+        return sha1.hexdigest()
+
+    def _node_fields(self, node):
+        # What a page can show about ``node``.
+        fields = [
+            node.kind, node.refid, node.name, node.title, node.file_name, node.link_name,
+            getattr(node.parent, "refid", None), getattr(node.def_in_file, "refid", None),
+            [child.refid for child in node.children],
+            [[str(part) for part in ref] for ref in node.base_compounds],
+            [[str(part) for part in ref] for ref in node.derived_compounds]
+        ]
+        if node.kind == "file":
+            fields += [
+                node.location, node.language, node.program_file, list(node.includes),
+                list(node.included_by), [n.refid for n in node.namespaces_used]
+            ]
+        elif node.kind == "function":
+            fields += [node.return_type, node.parameters, node.template]
+        return fields
+
+    def _source_fingerprint(self, node, cache):
+        # The contents of the Doxygen XML document of ``node``.  Members do not have their
+        # own compound document, their ``<memberdef>`` is read from the parent or the file
+        # (see memberDefinition).
+        if node.refid not in cache:
+            contents = self.compoundXMLContents(node)
+            cache[node.refid] = None if contents is None else \
+                hashlib.sha1(contents.encode("utf-8")).hexdigest()
+        if cache[node.refid] is not None:
+            return cache[node.refid]
+        sources = [
+            self._source_fingerprint(compound, cache)
+            for compound in [node.parent, node.def_in_file]
+            if compound is not None and compound is not node
+        ]
+        return "".join(sources) if sources else self._listing_fingerprint(cache)
+
+    def _listing_fingerprint(self, cache):
+        # The contents of index.xml (or the combined XML).
+        if self.configs.doxygenCombinedXML:
+            listing = self.configs.doxygenCombinedXML
+            if listing not in cache:
+                sha1 = hashlib.sha1()
+                with open(listing, "rb") as xml_file:
+                    sha1.update(xml_file.read())
+                cache[listing] = sha1.hexdigest()
+        else:
+            listing = "index.xml"
+            if listing not in cache:
+                contents = utils.readDoxygenXML(listing, self.configs)
+                cache[listing] = hashlib.sha1(contents.encode("utf-8")).hexdigest()
+        return cache[listing]
+
+    def renderOnDemandDocument(self, docname):
+        '''
+        Render the reStructuredText for a document deferred by
+        :func:`~exhale.graph.ExhaleRoot.deferNodeDocuments`.  Called from the Sphinx
+        ``source-read`` event, which may be in a parallel read worker process.  What it
+        reads, parses, and renders is counted by ``self.metrics``.
+
+        :Parameters:
+            ``docname`` (str)
+                The Sphinx docname (source path relative to the source directory,
+                without the suffix).
+
+        :Return (str or None):
+            The document contents, or ``None`` if ``docname`` is not an on demand
+            document.
+        '''
+        entry = self.on_demand_documents.get(docname, None)
+        if entry is None:
+            return None
+        generate, node = entry
+        self._render_stream = StringIO()
+        try:
+            # explode has moved on to a new BuildMetrics, keep counting into this root's.
+            with metrics.recording(self.metrics):
+                generate(node)
+                contents = self._render_stream.getvalue()
+                metrics.count("bytes_written", len(contents.encode("utf-8")))
+                metrics.count("pages_written")
+            return contents
+        finally:
+            self._render_stream.close()
+            self._render_stream = None
 
     def initializeNodeFilenameAndLink(self, node):
         '''
@@ -2505,8 +3322,8 @@ class ExhaleRoot(object):
             # additionally, I feel that nested classes should have their fully qualified
             # name without namespaces for clarity
             prepend_parent = False
-            if node.kind in ["class", "struct", "enum", "union"]:
-                if node.parent is not None and node.parent.kind in ["class", "struct"]:
+            if utils.KIND_IN_CLASS_HIERARCHY[node.kind_code]:
+                if node.parent is not None and utils.KIND_IS_CLASS_LIKE[node.parent.kind_code]:
                     prepend_parent = True
             if prepend_parent:
                 title = "{parent}::{child}".format(
@@ -2516,7 +3333,9 @@ class ExhaleRoot(object):
 
         # `unique_id` and `title` should be set appropriately for all nodes by this point
         if node.kind in SPECIAL_CASES:
-            node.link_name = "{kind}_{id}".format(kind=node.kind, id=unique_id)
+            node.link_name = "{prefix}{kind}_{id}".format(
+                prefix=self.configs._link_name_prefix, kind=node.kind, id=unique_id
+            )
             node.file_name = "{link_name}.rst".format(link_name=node.link_name)
             # Like the tree view documents, we want to .. include:: the indexpage on
             # the root library document without having sphinx generate html for the page
@@ -2537,7 +3356,9 @@ class ExhaleRoot(object):
             # file that defined it).  So a little bit of trickery is used to make sure
             # that the generated filename is at least _somewhat_ understandable for a
             # human to know what it is documenting (or at least its kind...).
-            node.link_name = "exhale_{kind}_{id}".format(kind=node.kind, id=unique_id)
+            node.link_name = "{prefix}exhale_{kind}_{id}".format(
+                prefix=self.configs._link_name_prefix, kind=node.kind, id=unique_id
+            )
             if unique_id.startswith(node.kind):
                 node.file_name = "{id}.rst".format(id=unique_id)
             else:
@@ -2565,7 +3386,7 @@ class ExhaleRoot(object):
 
         # Now force everything in the containment folder
         for attr in ["file_name", "program_file"]:
-            if hasattr(node, attr):
+            if getattr(node, attr) is not None:
                 full_path = os.path.join(self.root_directory, getattr(node, attr))
                 if platform.system() == "Windows" and len(full_path) >= configs.MAXIMUM_WINDOWS_PATH_LENGTH:
                     # NOTE: self.root_directory is *ALREADY* an absolute path, this
@@ -2654,8 +3475,9 @@ class ExhaleRoot(object):
             # Inform user when specified breathe directive will create problems
             for parameters_str in parameter_warning_map:
                 warn_functions = parameter_warning_map[parameters_str]
-                if len(warn_functions) > 1:
-                    sys.stderr.write(utils.critical(
+                # The native renderer documents the exact <memberdef>, no ambiguity.
+                if len(warn_functions) > 1 and not self.configs.nativeMemberRendering:
+                    logger.warning(utils.critical(
                         textwrap.dedent('''
                             Current limitations in .. doxygenfunction:: directive affect your code!
 
@@ -2695,7 +3517,7 @@ class ExhaleRoot(object):
                             Sorry :(
 
                         ''')
-                    ))
+                    ), type="exhale", subtype="duplicate_function")
 
     def generateSingleNodeRST(self, node):
         '''
@@ -2710,7 +3532,7 @@ class ExhaleRoot(object):
                 The leaf like node being generated by this method.
         '''
         try:
-            with codecs.open(node.file_name, "w", "utf-8") as gen_file:
+            with self.openGeneratedDocument(node.file_name) as gen_file:
                 ########################################################################
                 # Page header / linking.                                               #
                 ########################################################################
@@ -2722,14 +3544,15 @@ class ExhaleRoot(object):
                     defined_in = "- Defined in :ref:`{where}`".format(where=node.def_in_file.link_name)
                 else:
                     defined_in = ".. did not find file this was defined in"
-                    sys.stderr.write(utils.critical(
-                        "Did not locate file that defined {0} [{1}]; no link generated.\n".format(node.kind,
-                                                                                                  node.name)
-                    ))
+                    logger.warning(utils.critical(
+                        "Did not locate file that defined {0} [{1}]; no link generated.".format(
+                            node.kind, node.name
+                        )
+                    ), type="exhale", subtype="file_location")
 
                 # Add the metadata if they requested it
-                if configs.pageLevelConfigMeta:
-                    gen_file.write("{0}\n\n".format(configs.pageLevelConfigMeta))
+                if self.configs.pageLevelConfigMeta:
+                    gen_file.write("{0}\n\n".format(self.configs.pageLevelConfigMeta))
 
                 gen_file.write(textwrap.dedent('''\
                     {link}
@@ -2749,7 +3572,7 @@ class ExhaleRoot(object):
                     defined_in=defined_in
                 )))
 
-                contents = utils.contentsDirectiveOrNone(node.kind)
+                contents = utils.contentsDirectiveOrNone(node.kind, self.configs)
                 if contents:
                     gen_file.write(contents)
 
@@ -2877,7 +3700,7 @@ class ExhaleRoot(object):
                 ########################################################################
                 # Template parameter listing.                                          #
                 ########################################################################
-                if configs.includeTemplateParamOrderList:
+                if self.configs.includeTemplateParamOrderList:
                     template = node.templateParametersStringAsRestList(self.node_by_refid)
                     if template:
                         heading = "Template Parameter Order"
@@ -2896,14 +3719,12 @@ class ExhaleRoot(object):
                         gen_file.write("{template_params}\n\n".format(template_params=template))
 
                         # << verboseBuild
-                        utils.verbose_log(
-                            "+++ {kind} {name} has usable template parameters:\n{params}".format(
-                                kind=node.kind,
-                                name=node.name,
-                                params=utils.prefix("    ", template)
-                            ),
-                            utils.AnsiColors.BOLD_CYAN
-                        )
+                        if self.configs.verboseBuild:
+                            utils.verbose_log(
+                                "+++ {0} {1} has usable template parameters:\n{2}",
+                                utils.AnsiColors.BOLD_CYAN,
+                                node.kind, node.name, utils.prefix("    ", template)
+                            )
 
                 ########################################################################
                 # The Breathe directive!!!                                             #
@@ -2920,23 +3741,157 @@ class ExhaleRoot(object):
                         configs.SUB_SECTION_HEADING_CHAR
                     )
                 )))
-                # inject the appropriate doxygen directive and name of this node
-                directive = ".. {directive}:: {breathe_identifier}".format(
-                    directive=utils.kindAsBreatheDirective(node.kind),
-                    breathe_identifier=node.breathe_identifier()
-                )
-                gen_file.write("\n{directive}\n".format(directive=directive))
-                # include any specific directives for this doxygen directive
-                specifications = utils.prefix(
-                    "   ",
-                    "\n".join(spec for spec in utils.specificationsForKind(node.kind))
-                )
-                gen_file.write(specifications)
+                native = None
+                if self.configs.nativeMemberRendering and node.kind in utils.MEMBER_KINDS:
+                    native = self.nativeMemberDirective(node)
+
+                if native:
+                    gen_file.write("\n{native}\n".format(native=native))
+                else:
+                    # inject the appropriate doxygen directive and name of this node
+                    directive = ".. {directive}:: {breathe_identifier}".format(
+                        directive=utils.kindAsBreatheDirective(node.kind),
+                        breathe_identifier=node.breathe_identifier()
+                    )
+                    gen_file.write("\n{directive}\n".format(directive=directive))
+                    # include any specific directives for this doxygen directive
+                    specifications = utils.prefix(
+                        "   ",
+                        "\n".join(spec for spec in utils.specificationsForKind(node.kind, self.configs))
+                    )
+                    gen_file.write(specifications)
         except:
             utils.fancyError(
                 "Critical error while generating the file for [{0}].".format(node.file_name)
             )
 
+    def memberDefinition(self, node):
+        '''
+        Return the ``<memberdef>`` describing a node in :data:`~exhale.utils.MEMBER_KINDS`.
+
+        Doxygen places these in the XML of the enclosing namespace, class, or file.  The
+        first time a compound is searched every ``<memberdef>`` in it is gathered into
+        ``self.member_definitions``, so each compound is only searched once no matter
+        how many members it has.  A ``<memberdef>`` is dropped once it is returned, since
+        rendering it modifies the descriptions.  When the node is rendered again (e.g.,
+        by :func:`~exhale.graph.ExhaleRoot.renderOnDemandDocument`), its compound is
+        parsed again for an unmodified copy.
+
+        :Parameters:
+            ``node`` (ExhaleNode)
+                The leaf like node to find the ``<memberdef>`` of.
+
+        :Return (bs4.element.Tag or None):
+            The ``<memberdef>``, or ``None`` if it could not be found.
+        '''
+        for compound in [node.parent, node.def_in_file]:
+            if self.member_definitions.get(node.refid, None) is not None:
+                break
+            if compound is None or compound.refid in self.member_definition_sources:
+                continue
+
+            self.member_definition_sources.add(compound.refid)
+            # Only the descriptions are left of the documents parsing kept.
+            compound_soup = self.parsedCompoundXML(compound, fresh=compound.refid in self.partial_xml)
+            if not compound_soup:
+                continue
+            for memberdef in compound_soup.find_all("memberdef"):
+                refid = memberdef.attrs.get("id", None)
+                if refid in self.node_by_refid and refid not in self.member_definitions and \
+                        self.node_by_refid[refid].kind in utils.MEMBER_KINDS:
+                    self.member_definitions[refid] = memberdef
+            # File and namespace documents are released after their descriptions are
+            # converted, nothing else needs e.g. the class documents.
+            if compound.kind not in ("file", "namespace"):
+                self.releaseParsedXML([compound.refid])
+
+        memberdef = self.member_definitions.get(node.refid, None)
+        if memberdef is None and node.refid in self.member_definitions:
+            # Rendered before, which modified the <memberdef> that was gathered.
+            for compound in [node.parent, node.def_in_file]:
+                if compound is None:
+                    continue
+                compound_soup = self.parsedCompoundXML(compound, fresh=True)
+                if compound_soup:
+                    memberdef = compound_soup.find("memberdef", attrs={"id": node.refid})
+                if memberdef is not None:
+                    break
+        self.member_definitions[node.refid] = None
+        return memberdef
+
+    def nativeMemberDirective(self, node):
+        '''
+        Render a node in :data:`~exhale.utils.MEMBER_KINDS` with the Sphinx C++ domain
+        (or ``.. c:macro::`` for defines), see
+        :data:`~exhale.configs.nativeMemberRendering`.
+
+        :Parameters:
+            ``node`` (ExhaleNode)
+                The leaf like node being documented.
+
+        :Return (str or None):
+            The label and directive to write, or ``None`` when the Breathe directive
+            should be used instead (the ``<memberdef>`` was not found, or the node is
+            an anonymous enum).
+        '''
+        memberdef = self.memberDefinition(node)
+        if memberdef is None:
+            return None
+
+        def member_text(tag_name):
+            tag = memberdef.find(tag_name, recursive=False)
+            return " ".join(tag.get_text().split()) if tag else ""
+
+        signature = None
+        enumerators = []
+        if node.kind == "define":
+            directive = "c:macro"
+            signature = member_text("name")
+            params = [p.get_text().strip() for p in memberdef.find_all("defname")]
+            if memberdef.find("param", recursive=False):
+                signature = "{0}({1})".format(signature, ", ".join(params))
+        elif node.kind == "enum":
+            if "@" in node.name:
+                return None
+            directive = "cpp:enum-class" if memberdef.attrs.get("strong", None) == "yes" else "cpp:enum"
+            signature = node.name
+            underlying = member_text("type")
+            if underlying:
+                signature = "{0} : {1}".format(signature, underlying)
+            for enumvalue in memberdef.find_all("enumvalue", recursive=False):
+                enumerator = enumvalue.find("name").get_text().strip()
+                initializer = enumvalue.find("initializer", recursive=False)
+                if initializer:
+                    enumerator = "{0} {1}".format(enumerator, " ".join(initializer.get_text().split()))
+                content = parse.getMemberDescriptionRST(self, node, enumvalue)
+                enumerators.append(".. cpp:enumerator:: {0}{1}".format(
+                    enumerator, "\n\n{0}".format(utils.indent(content, "   ")) if content else ""
+                ))
+        else:
+            directive = {"function": "cpp:function", "typedef": "cpp:type", "variable": "cpp:var"}[node.kind]
+            definition = member_text("definition")
+            if node.kind == "typedef":
+                # `typedef int foo` -> `int foo`, `using foo = int` -> `foo = int`
+                for keyword in ("typedef ", "using "):
+                    if definition.startswith(keyword):
+                        definition = definition[len(keyword):]
+                        break
+            signature = "{template}{definition}{args}".format(
+                template=utils.templateDeclaration(memberdef),
+                definition=definition,
+                args=member_text("argsstring")
+            )
+
+        content = [parse.getMemberDescriptionRST(self, node, memberdef)] + enumerators
+        content = "\n\n".join(c for c in content if c)
+        return ".. _{prefix}{refid}:\n\n.. {directive}:: {signature}\n{content}".format(
+            prefix=self.configs._link_name_prefix,
+            refid=node.refid,
+            directive=directive,
+            signature=signature,
+            content="\n{0}\n".format(utils.indent(content, "   ")) if content else ""
+        )
+
     def generatePageDocuments(self):
         '''
         Generates the reStructuredText document for every page.
@@ -2944,7 +3899,8 @@ class ExhaleRoot(object):
         all_pages = [p for p in self.pages]
         while len(all_pages) > 0:
             page = all_pages.pop()
-            self.generateSinglePageDocument(page)
+            with self.metrics.compound(page, "generate"):
+                self.generateSinglePageDocument(page)
             for subpage in page.children:
                 all_pages.append(subpage)
 
@@ -2957,7 +3913,7 @@ class ExhaleRoot(object):
                 The "page" node being generated by this method.
         '''
         try:
-            with codecs.open(node.file_name, "w", "utf-8") as gen_file:
+            with self.openGeneratedDocument(node.file_name) as gen_file:
                 ########################################################################
                 # Page header / linking.                                               #
                 ########################################################################
@@ -2965,8 +3921,8 @@ class ExhaleRoot(object):
                 link_declaration = ".. _{0}:".format(node.link_name)
 
                 # Add the metadata if they requested it
-                if configs.pageLevelConfigMeta:
-                    gen_file.write("{0}\n\n".format(configs.pageLevelConfigMeta))
+                if self.configs.pageLevelConfigMeta:
+                    gen_file.write("{0}\n\n".format(self.configs.pageLevelConfigMeta))
 
                 gen_file.write(textwrap.dedent('''\
                     {link}
@@ -2982,7 +3938,7 @@ class ExhaleRoot(object):
                     )
                 )))
 
-                contents = utils.contentsDirectiveOrNone(node.kind)
+                contents = utils.contentsDirectiveOrNone(node.kind, self.configs)
                 if contents:
                     gen_file.write(contents)
 
@@ -2995,7 +3951,7 @@ class ExhaleRoot(object):
                 # include any specific directives for this doxygen directive
                 specifications = utils.prefix(
                     "   ",
-                    "\n".join(spec for spec in utils.specificationsForKind(node.kind))
+                    "\n".join(spec for spec in utils.specificationsForKind(node.kind, self.configs))
                 )
                 gen_file.write(specifications)
         except:
@@ -3020,9 +3976,11 @@ class ExhaleRoot(object):
                 child.findNestedNamespaces(nested_namespaces)
             # generate the children first
             for nested in reversed(sorted(nested_namespaces)):
-                self.generateSingleNamespace(nested)
+                with self.metrics.compound(nested, "generate"):
+                    self.generateSingleNamespace(nested)
             # generate this top level namespace
-            self.generateSingleNamespace(n)
+            with self.metrics.compound(n, "generate"):
+                self.generateSingleNamespace(n)
 
     def generateSingleNamespace(self, nspace):
         '''
@@ -3034,10 +3992,10 @@ class ExhaleRoot(object):
                 The namespace node to create the reStructuredText document for.
         '''
         try:
-            with codecs.open(nspace.file_name, "w", "utf-8") as gen_file:
+            with self.openGeneratedDocument(nspace.file_name) as gen_file:
                 # Add the metadata if they requested it
-                if configs.pageLevelConfigMeta:
-                    gen_file.write("{0}\n\n".format(configs.pageLevelConfigMeta))
+                if self.configs.pageLevelConfigMeta:
+                    gen_file.write("{0}\n\n".format(self.configs.pageLevelConfigMeta))
 
                 nspace.title = "{0} {1}".format(utils.qualifyKind(nspace.kind), nspace.name)
 
@@ -3059,7 +4017,7 @@ class ExhaleRoot(object):
                     gen_file.write("{0}\n\n".format(brief))
 
                 # include the contents directive if requested
-                contents = utils.contentsDirectiveOrNone(nspace.kind)
+                contents = utils.contentsDirectiveOrNone(nspace.kind, self.configs)
                 if contents:
                     gen_file.write("{0}\n\n".format(contents))
 
@@ -3089,49 +4047,31 @@ class ExhaleRoot(object):
         :Return (str):
             The string to be written to the namespace node's reStructuredText document.
         '''
-        # sort the children
-        nsp_namespaces        = []
-        nsp_nested_class_like = []
-        nsp_enums             = []
-        nsp_functions         = []
-        nsp_typedefs          = []
-        nsp_unions            = []
-        nsp_variables         = []
+        # sort the children, one list per _NAMESPACE_CHILD_SECTIONS entry
+        sections = tuple([] for _ in _NAMESPACE_CHILD_SECTIONS)
         for child in nspace.children:
             # Skip children whose names were requested to be explicitly ignored.
             should_exclude = False
-            for exclude in configs._compiled_listing_exclude:
+            for exclude in self.configs._compiled_listing_exclude:
                 if exclude.match(child.name):
                     should_exclude = True
+                    break
             if should_exclude:
                 continue
 
-            if child.kind == "namespace":
-                nsp_namespaces.append(child)
-            elif child.kind == "struct" or child.kind == "class":
-                child.findNestedClassLike(nsp_nested_class_like)
-                child.findNestedEnums(nsp_enums)
-                child.findNestedUnions(nsp_unions)
-            elif child.kind == "enum":
-                nsp_enums.append(child)
-            elif child.kind == "function":
-                nsp_functions.append(child)
-            elif child.kind == "typedef":
-                nsp_typedefs.append(child)
-            elif child.kind == "union":
-                nsp_unions.append(child)
-            elif child.kind == "variable":
-                nsp_variables.append(child)
+            if utils.KIND_IS_CLASS_LIKE[child.kind_code]:
+                child.findNestedClassLike(sections[1])
+                child.findNestedEnums(sections[2])
+                child.findNestedUnions(sections[5])
+            else:
+                section = _NAMESPACE_CHILD_SECTION[child.kind_code]
+                if section is not None:
+                    sections[section].append(child)
 
         # generate their headings if they exist (no Defines...that's not a C++ thing...)
         children_stream = StringIO()
-        self.generateSortedChildListString(children_stream, "Namespaces", nsp_namespaces)
-        self.generateSortedChildListString(children_stream, "Classes", nsp_nested_class_like)
-        self.generateSortedChildListString(children_stream, "Enums", nsp_enums)
-        self.generateSortedChildListString(children_stream, "Functions", nsp_functions)
-        self.generateSortedChildListString(children_stream, "Typedefs", nsp_typedefs)
-        self.generateSortedChildListString(children_stream, "Unions", nsp_unions)
-        self.generateSortedChildListString(children_stream, "Variables", nsp_variables)
+        for title, lst in zip(_NAMESPACE_CHILD_SECTIONS, sections):
+            self.generateSortedChildListString(children_stream, title, lst)
         # read out the buffer contents, close it and return the desired string
         children_string = children_stream.getvalue()
         children_stream.close()
@@ -3186,293 +4126,313 @@ class ExhaleRoot(object):
         defined (e.g. classes) or referred to (e.g. included files or files that include
         this file).
 
+        Calls :func:`~exhale.graph.ExhaleRoot.generateSingleFileProgramListing` and
+        :func:`~exhale.graph.ExhaleRoot.generateSingleFileNodeDocument` for every file.
+        '''
+        for f in self.files:
+            with self.metrics.compound(f, "generate"):
+                # if the programlisting was included, length will be at least 1 line
+                if len(f.program_listing) > 0:
+                    self.generateSingleFileProgramListing(f)
+                self.generateSingleFileNodeDocument(f)
+            # Nothing reads the listing after this, it is most of the memory of a file.
+            f.program_listing = ()
+
+    def generateSingleFileProgramListing(self, f):
+        '''
+        Helper method for :func:`~exhale.graph.ExhaleRoot.generateFileNodeDocuments`.
+        Writes the program listing reStructuredText document for the given file.
+
+        :Parameters:
+            ``f`` (ExhaleNode)
+                The file node with a non-empty ``program_listing``.
+        '''
+        lexer = utils.doxygenLanguageToPygmentsLexer(f.location, f.language, self.configs)
+        full_program_listing = '.. code-block:: {0}\n\n'.format(lexer)
+
+        # need to reformat each line to remove xml tags / put <>& back in
+        for pgf_line in f.program_listing:
+            fixed_whitespace = re.sub(r'<sp/>', ' ', pgf_line)
+            # for our purposes, this is good enough:
+            #     https://stackoverflow.com/a/4869782/3814202
+            no_xml_tags  = re.sub(r'<[^<]+?>', '', fixed_whitespace)
+            revive_lt    = re.sub(r'&lt;', '<', no_xml_tags)
+            revive_gt    = re.sub(r'&gt;', '>', revive_lt)
+            revive_quote = re.sub(r'&quot;', '"', revive_gt)
+            revive_apos  = re.sub(r'&apos;', "'", revive_quote)
+            revive_amp   = re.sub(r'&amp;', '&', revive_apos)
+            full_program_listing = "{}   {}".format(full_program_listing, revive_amp)
+
+        # create the programlisting file
+        try:
+            with self.openGeneratedDocument(f.program_file) as gen_file:
+                # Add the metadata if they requested it
+                if self.configs.pageLevelConfigMeta:
+                    gen_file.write("{0}\n\n".format(self.configs.pageLevelConfigMeta))
+
+                # generate a link label for every generated file
+                link_declaration = ".. _{}:".format(f.program_link_name)
+                # every generated file must have a header for sphinx to be happy
+                prog_title = "Program Listing for {} {}".format(utils.qualifyKind(f.kind), f.name)
+                gen_file.write(textwrap.dedent('''
+                    {link}
+
+                    {heading}
+                    {heading_mark}
+
+                    |exhale_lsh| :ref:`Return to documentation for file <{file}>` (``{location}``)
+
+                    .. |exhale_lsh| unicode:: U+021B0 .. UPWARDS ARROW WITH TIP LEFTWARDS
+
+                '''.format(  # NOTE: newline required at end (#171)
+                    link=link_declaration,
+                    heading=prog_title,
+                    heading_mark=utils.heading_mark(
+                        prog_title,
+                        configs.SECTION_HEADING_CHAR
+                    ),
+                    file=f.link_name,
+                    location=f.location
+                )))
+                gen_file.write(full_program_listing)
+        except:
+            utils.fancyError(
+                "Critical error while generating the file for [{0}]".format(f.file_name)
+            )
+
+    def generateSingleFileNodeDocument(self, f):
+        '''
+        Helper method for :func:`~exhale.graph.ExhaleRoot.generateFileNodeDocuments`.
+        Writes the reStructuredText document for the given file.
+
         .. todo::
 
            writing the actual file should be set in one method so that things for files,
            namespaces, and leaflike nodes don't keep getting out of sync
+
+        :Parameters:
+            ``f`` (ExhaleNode)
+                The file node to create the reStructuredText document for.
         '''
-        for f in self.files:
-            # if the programlisting was included, length will be at least 1 line
-            if len(f.program_listing) > 0:
-                include_program_listing = True
-                lexer = utils.doxygenLanguageToPygmentsLexer(f.location, f.language)
-                full_program_listing = '.. code-block:: {0}\n\n'.format(lexer)
-
-                # need to reformat each line to remove xml tags / put <>& back in
-                for pgf_line in f.program_listing:
-                    fixed_whitespace = re.sub(r'<sp/>', ' ', pgf_line)
-                    # for our purposes, this is good enough:
-                    #     https://stackoverflow.com/a/4869782/3814202
-                    no_xml_tags  = re.sub(r'<[^<]+?>', '', fixed_whitespace)
-                    revive_lt    = re.sub(r'&lt;', '<', no_xml_tags)
-                    revive_gt    = re.sub(r'&gt;', '>', revive_lt)
-                    revive_quote = re.sub(r'&quot;', '"', revive_gt)
-                    revive_apos  = re.sub(r'&apos;', "'", revive_quote)
-                    revive_amp   = re.sub(r'&amp;', '&', revive_apos)
-                    full_program_listing = "{}   {}".format(full_program_listing, revive_amp)
-
-                # create the programlisting file
-                try:
-                    with codecs.open(f.program_file, "w", "utf-8") as gen_file:
-                        # Add the metadata if they requested it
-                        if configs.pageLevelConfigMeta:
-                            gen_file.write("{0}\n\n".format(configs.pageLevelConfigMeta))
-
-                        # generate a link label for every generated file
-                        link_declaration = ".. _{}:".format(f.program_link_name)
-                        # every generated file must have a header for sphinx to be happy
-                        prog_title = "Program Listing for {} {}".format(utils.qualifyKind(f.kind), f.name)
-                        gen_file.write(textwrap.dedent('''
-                            {link}
+        include_program_listing = len(f.program_listing) > 0
+        if len(f.location) > 0:
+            heading = "Definition (``{where}``)".format(where=f.location)
+            file_definition = textwrap.dedent('''
+                {heading}
+                {heading_mark}
 
-                            {heading}
-                            {heading_mark}
+            '''.format(
+                heading=heading,
+                heading_mark=utils.heading_mark(
+                    heading,
+                    configs.SUB_SECTION_HEADING_CHAR
+                )
+            ))
+        else:
+            file_definition = ""
 
-                            |exhale_lsh| :ref:`Return to documentation for file <{file}>` (``{location}``)
+        if include_program_listing and file_definition != "":
+            prog_file_definition = textwrap.dedent('''
+                .. toctree::
+                   :maxdepth: 1
 
-                            .. |exhale_lsh| unicode:: U+021B0 .. UPWARDS ARROW WITH TIP LEFTWARDS
+                   {prog_link}
+            '''.format(prog_link=os.path.basename(f.program_file)))
+            file_definition = "{}{}".format(file_definition, prog_file_definition)
 
-                        '''.format(  # NOTE: newline required at end (#171)
-                            link=link_declaration,
-                            heading=prog_title,
-                            heading_mark=utils.heading_mark(
-                                prog_title,
-                                configs.SECTION_HEADING_CHAR
-                            ),
-                            file=f.link_name,
-                            location=f.location
-                        )))
-                        gen_file.write(full_program_listing)
-                except:
-                    utils.fancyError(
-                        "Critical error while generating the file for [{0}]".format(f.file_name)
-                    )
-            else:
-                include_program_listing = False
+        if len(f.includes) > 0:
+            file_includes_stream = StringIO()
+            heading = "Includes"
+            file_includes_stream.write(textwrap.dedent('''
+                {heading}
+                {heading_mark}
 
-        for f in self.files:
-            if len(f.location) > 0:
-                heading = "Definition (``{where}``)".format(where=f.location)
-                file_definition = textwrap.dedent('''
-                    {heading}
-                    {heading_mark}
+            '''.format(
+                heading=heading,
+                heading_mark=utils.heading_mark(
+                    heading,
+                    configs.SUB_SECTION_HEADING_CHAR
+                )
+            )))
+            for incl in sorted(f.includes):
+                local_file = self.includedFile(incl)
+                link = local_file.link_name if local_file is not None else self.projectLink("files", incl)
+                if link is not None:
+                    file_includes_stream.write(textwrap.dedent('''
+                        - ``{include}`` (:ref:`{link}`)
+                    '''.format(include=incl, link=link)))
+                else:
+                    file_includes_stream.write(textwrap.dedent('''
+                        - ``{include}``
+                    '''.format(include=incl)))
 
-                '''.format(
-                    heading=heading,
-                    heading_mark=utils.heading_mark(
-                        heading,
-                        configs.SUB_SECTION_HEADING_CHAR
-                    )
-                ))
-            else:
-                file_definition = ""
+            file_includes = file_includes_stream.getvalue()
+            file_includes_stream.close()
+        else:
+            file_includes = ""
 
-            if include_program_listing and file_definition != "":
-                prog_file_definition = textwrap.dedent('''
-                    .. toctree::
-                       :maxdepth: 1
+        if len(f.included_by) > 0:
+            file_included_by_stream = StringIO()
+            heading = "Included By"
+            file_included_by_stream.write(textwrap.dedent('''
+                {heading}
+                {heading_mark}
 
-                       {prog_link}
-                '''.format(prog_link=os.path.basename(f.program_file)))
-                file_definition = "{}{}".format(file_definition, prog_file_definition)
+            '''.format(
+                heading=heading,
+                heading_mark=utils.heading_mark(
+                    heading,
+                    configs.SUB_SECTION_HEADING_CHAR
+                )
+            )))
+            for incl_ref, incl_name in f.included_by:
+                incl_file = self.node_by_refid.get(incl_ref, None)
+                if incl_file is not None and incl_file.kind == "file":
+                    file_included_by_stream.write(textwrap.dedent('''
+                        - :ref:`{link}`
+                    '''.format(link=incl_file.link_name)))
+            file_included_by = file_included_by_stream.getvalue()
+            file_included_by_stream.close()
+        else:
+            file_included_by = ""
+
+        # generate their headings if they exist --- DO NOT USE findNested*, these are included recursively
+        file_structs    = []
+        file_classes    = []
+        file_enums      = []
+        file_functions  = []
+        file_typedefs   = []
+        file_unions     = []
+        file_variables  = []
+        file_defines    = []
+        for child in f.children:
+            if child.kind == "struct":
+                file_structs.append(child)
+            elif child.kind == "class":
+                file_classes.append(child)
+            elif child.kind == "enum":
+                file_enums.append(child)
+            elif child.kind == "function":
+                file_functions.append(child)
+            elif child.kind == "typedef":
+                file_typedefs.append(child)
+            elif child.kind == "union":
+                file_unions.append(child)
+            elif child.kind == "variable":
+                file_variables.append(child)
+            elif child.kind == "define":
+                file_defines.append(child)
 
-            if len(f.includes) > 0:
-                file_includes_stream = StringIO()
-                heading = "Includes"
-                file_includes_stream.write(textwrap.dedent('''
-                    {heading}
-                    {heading_mark}
+        # generate the listing of children referenced to from this file
+        children_stream = StringIO()
+        self.generateSortedChildListString(children_stream, "Namespaces", f.namespaces_used)
+        self.generateSortedChildListString(children_stream, "Classes", file_structs + file_classes)
+        self.generateSortedChildListString(children_stream, "Enums", file_enums)
+        self.generateSortedChildListString(children_stream, "Functions", file_functions)
+        self.generateSortedChildListString(children_stream, "Defines", file_defines)
+        self.generateSortedChildListString(children_stream, "Typedefs", file_typedefs)
+        self.generateSortedChildListString(children_stream, "Unions", file_unions)
+        self.generateSortedChildListString(children_stream, "Variables", file_variables)
 
-                '''.format(
-                    heading=heading,
-                    heading_mark=utils.heading_mark(
-                        heading,
-                        configs.SUB_SECTION_HEADING_CHAR
-                    )
-                )))
-                for incl in sorted(f.includes):
-                    local_file = None
-                    for incl_file in self.files:
-                        if incl in incl_file.location:
-                            local_file = incl_file
-                            break
-                    if local_file is not None:
-                        file_includes_stream.write(textwrap.dedent('''
-                            - ``{include}`` (:ref:`{link}`)
-                        '''.format(include=incl, link=local_file.link_name)))
-                    else:
-                        file_includes_stream.write(textwrap.dedent('''
-                            - ``{include}``
-                        '''.format(include=incl)))
+        children_string = children_stream.getvalue()
+        children_stream.close()
 
-                file_includes = file_includes_stream.getvalue()
-                file_includes_stream.close()
-            else:
-                file_includes = ""
+        try:
+            with self.openGeneratedDocument(f.file_name) as gen_file:
+                # Add the metadata if they requested it
+                if self.configs.pageLevelConfigMeta:
+                    gen_file.write("{0}\n\n".format(self.configs.pageLevelConfigMeta))
+
+                # generate a link label for every generated file
+                link_declaration = ".. _{0}:".format(f.link_name)
+                # every generated file must have a header for sphinx to be happy
+                f.title = "{0} {1}".format(utils.qualifyKind(f.kind), f.name)
+                gen_file.write(textwrap.dedent('''
+                    {link}
 
-            if len(f.included_by) > 0:
-                file_included_by_stream = StringIO()
-                heading = "Included By"
-                file_included_by_stream.write(textwrap.dedent('''
                     {heading}
                     {heading_mark}
-
                 '''.format(
-                    heading=heading,
+                    link=link_declaration,
+                    heading=f.title,
                     heading_mark=utils.heading_mark(
-                        heading,
-                        configs.SUB_SECTION_HEADING_CHAR
+                        f.title,
+                        configs.SECTION_HEADING_CHAR
                     )
                 )))
-                for incl_ref, incl_name in f.included_by:
-                    for incl_file in self.files:
-                        if incl_ref == incl_file.refid:
-                            file_included_by_stream.write(textwrap.dedent('''
-                                - :ref:`{link}`
-                            '''.format(link=incl_file.link_name)))
-                            break
-                file_included_by = file_included_by_stream.getvalue()
-                file_included_by_stream.close()
-            else:
-                file_included_by = ""
-
-            # generate their headings if they exist --- DO NOT USE findNested*, these are included recursively
-            file_structs    = []
-            file_classes    = []
-            file_enums      = []
-            file_functions  = []
-            file_typedefs   = []
-            file_unions     = []
-            file_variables  = []
-            file_defines    = []
-            for child in f.children:
-                if child.kind == "struct":
-                    file_structs.append(child)
-                elif child.kind == "class":
-                    file_classes.append(child)
-                elif child.kind == "enum":
-                    file_enums.append(child)
-                elif child.kind == "function":
-                    file_functions.append(child)
-                elif child.kind == "typedef":
-                    file_typedefs.append(child)
-                elif child.kind == "union":
-                    file_unions.append(child)
-                elif child.kind == "variable":
-                    file_variables.append(child)
-                elif child.kind == "define":
-                    file_defines.append(child)
-
-            # generate the listing of children referenced to from this file
-            children_stream = StringIO()
-            self.generateSortedChildListString(children_stream, "Namespaces", f.namespaces_used)
-            self.generateSortedChildListString(children_stream, "Classes", file_structs + file_classes)
-            self.generateSortedChildListString(children_stream, "Enums", file_enums)
-            self.generateSortedChildListString(children_stream, "Functions", file_functions)
-            self.generateSortedChildListString(children_stream, "Defines", file_defines)
-            self.generateSortedChildListString(children_stream, "Typedefs", file_typedefs)
-            self.generateSortedChildListString(children_stream, "Unions", file_unions)
-            self.generateSortedChildListString(children_stream, "Variables", file_variables)
-
-            children_string = children_stream.getvalue()
-            children_stream.close()
 
-            try:
-                with codecs.open(f.file_name, "w", "utf-8") as gen_file:
-                    # Add the metadata if they requested it
-                    if configs.pageLevelConfigMeta:
-                        gen_file.write("{0}\n\n".format(configs.pageLevelConfigMeta))
-
-                    # generate a link label for every generated file
-                    link_declaration = ".. _{0}:".format(f.link_name)
-                    # every generated file must have a header for sphinx to be happy
-                    f.title = "{0} {1}".format(utils.qualifyKind(f.kind), f.name)
+                if f.parent and f.parent.kind == "dir":
                     gen_file.write(textwrap.dedent('''
-                        {link}
+                        |exhale_lsh| :ref:`Parent directory <{parent_link}>` (``{parent_name}``)
 
-                        {heading}
-                        {heading_mark}
-                    '''.format(
-                        link=link_declaration,
-                        heading=f.title,
-                        heading_mark=utils.heading_mark(
-                            f.title,
-                            configs.SECTION_HEADING_CHAR
-                        )
+                        .. |exhale_lsh| unicode:: U+021B0 .. UPWARDS ARROW WITH TIP LEFTWARDS
+
+                    '''.format(  # NOTE: newline required at end (#171)
+                        parent_link=f.parent.link_name, parent_name=f.parent.name
                     )))
 
-                    if f.parent and f.parent.kind == "dir":
-                        gen_file.write(textwrap.dedent('''
-                            |exhale_lsh| :ref:`Parent directory <{parent_link}>` (``{parent_name}``)
+                brief, detailed = parse.getBriefAndDetailedRST(self, f)
+                if brief:
+                    gen_file.write("\n{brief}\n".format(brief=brief))
 
-                            .. |exhale_lsh| unicode:: U+021B0 .. UPWARDS ARROW WITH TIP LEFTWARDS
+                # include the contents directive if requested
+                contents = utils.contentsDirectiveOrNone(f.kind, self.configs)
+                if contents:
+                    gen_file.write(contents)
 
-                        '''.format(  # NOTE: newline required at end (#171)
-                            parent_link=f.parent.link_name, parent_name=f.parent.name
-                        )))
+                gen_file.write(textwrap.dedent('''
+                    {definition}
 
-                    brief, detailed = parse.getBriefAndDetailedRST(self, f)
-                    if brief:
-                        gen_file.write("\n{brief}\n".format(brief=brief))
+                    {detailed}
 
-                    # include the contents directive if requested
-                    contents = utils.contentsDirectiveOrNone(f.kind)
-                    if contents:
-                        gen_file.write(contents)
+                    {includes}
 
-                    gen_file.write(textwrap.dedent('''
-                        {definition}
+                    {includeby}
 
-                        {detailed}
+                    {children}
+                '''.format(
+                    definition=file_definition,
+                    detailed=detailed,
+                    includes=file_includes,
+                    includeby=file_included_by,
+                    children=children_string
+                )).lstrip())
+        except:
+            utils.fancyError(
+                "Critical error while generating the file for [{0}]".format(f.file_name)
+            )
 
-                        {includes}
+        if self.configs.generateBreatheFileDirectives:
+            try:
+                with self.openGeneratedDocument(f.file_name, "a") as gen_file:
+                    heading        = "Full File Listing"
+                    heading_mark   = utils.heading_mark(
+                        heading, configs.SUB_SECTION_HEADING_CHAR
+                    )
+                    directive      = utils.kindAsBreatheDirective(f.kind)
+                    node           = f.location
+                    specifications = "\n   ".join(
+                        spec for spec in utils.specificationsForKind(f.kind, self.configs)
+                    )
 
-                        {includeby}
+                    gen_file.write(textwrap.dedent('''
+                        {heading}
+                        {heading_mark}
 
-                        {children}
+                        .. {directive}:: {node}
+                           {specifications}
                     '''.format(
-                        definition=file_definition,
-                        detailed=detailed,
-                        includes=file_includes,
-                        includeby=file_included_by,
-                        children=children_string
-                    )).lstrip())
+                        heading=heading,
+                        heading_mark=heading_mark,
+                        directive=directive,
+                        node=node,
+                        specifications=specifications
+                    )))
             except:
                 utils.fancyError(
-                    "Critical error while generating the file for [{0}]".format(f.file_name)
+                    "Critical error while generating the breathe directive for [{0}]".format(f.file_name)
                 )
 
-            if configs.generateBreatheFileDirectives:
-                try:
-                    with codecs.open(f.file_name, "a", "utf-8") as gen_file:
-                        heading        = "Full File Listing"
-                        heading_mark   = utils.heading_mark(
-                            heading, configs.SUB_SECTION_HEADING_CHAR
-                        )
-                        directive      = utils.kindAsBreatheDirective(f.kind)
-                        node           = f.location
-                        specifications = "\n   ".join(
-                            spec for spec in utils.specificationsForKind(f.kind)
-                        )
-
-                        gen_file.write(textwrap.dedent('''
-                            {heading}
-                            {heading_mark}
-
-                            .. {directive}:: {node}
-                               {specifications}
-                        '''.format(
-                            heading=heading,
-                            heading_mark=heading_mark,
-                            directive=directive,
-                            node=node,
-                            specifications=specifications
-                        )))
-                except:
-                    utils.fancyError(
-                        "Critical error while generating the breathe directive for [{0}]".format(f.file_name)
-                    )
-
     def generateDirectoryNodeDocuments(self):
         '''
         Generates all of the directory reStructuredText documents.
@@ -3482,7 +4442,8 @@ class ExhaleRoot(object):
             d.findNestedDirectories(all_dirs)
 
         for d in all_dirs:
-            self.generateDirectoryNodeRST(d)
+            with self.metrics.compound(d, "generate"):
+                self.generateDirectoryNodeRST(d)
 
     def generateDirectoryNodeRST(self, node):
         '''
@@ -3556,10 +4517,10 @@ class ExhaleRoot(object):
         # generate the file for this directory
         try:
             #flake8fail get rid of {} in this method
-            with codecs.open(node.file_name, "w", "utf-8") as gen_file:
+            with self.openGeneratedDocument(node.file_name) as gen_file:
                 # Add the metadata if they requested it
-                if configs.pageLevelConfigMeta:
-                    gen_file.write("{0}\n\n".format(configs.pageLevelConfigMeta))
+                if self.configs.pageLevelConfigMeta:
+                    gen_file.write("{0}\n\n".format(self.configs.pageLevelConfigMeta))
 
                 # generate a link label for every generated file
                 link_declaration = ".. _{0}:\n\n".format(node.link_name)
@@ -3610,7 +4571,7 @@ class ExhaleRoot(object):
         '''
         try:
 
-            with codecs.open(self.full_root_file_path, "a", "utf-8") as generated_index:
+            with self.openGeneratedDocument(self.full_root_file_path, "a") as generated_index:
                 # Include index page, if present
                 for page in self.pages:
                     if page.refid == "indexpage":
@@ -3633,9 +4594,9 @@ class ExhaleRoot(object):
                     ))
 
                 # Add the afterHierarchyDescription if provided
-                if configs.afterHierarchyDescription:
+                if self.configs.afterHierarchyDescription:
                     generated_index.write(
-                        "\n{0}\n\n".format(configs.afterHierarchyDescription)
+                        "\n{0}\n\n".format(self.configs.afterHierarchyDescription)
                     )
 
                 # Include the unabridged API
@@ -3644,14 +4605,14 @@ class ExhaleRoot(object):
                 ))
 
                 # Add the afterBodySummary if provided
-                if configs.afterBodySummary:
+                if self.configs.afterBodySummary:
                     generated_index.write(
-                        "\n{0}\n\n".format(configs.afterBodySummary)
+                        "\n{0}\n\n".format(self.configs.afterBodySummary)
                     )
 
                 # The following should only be applied to the page library root page
                 # Applying it to other pages will result in an error
-                if self.use_tree_view and configs.treeViewIsBootstrap:
+                if self.use_tree_view and self.configs.treeViewIsBootstrap:
                     generated_index.write(textwrap.dedent('''
 
                         .. raw:: html
@@ -3738,18 +4699,18 @@ class ExhaleRoot(object):
                                }});
                            </script>
                     '''.format(
-                        icon_mimic=configs.treeViewBootstrapIconMimicColor,
-                        page_idx=configs._page_hierarchy_id,
-                        page_func_name=configs._bstrap_page_hierarchy_fn_data_name,
-                        class_idx=configs._class_hierarchy_id,
-                        class_func_name=configs._bstrap_class_hierarchy_fn_data_name,
-                        file_idx=configs._file_hierarchy_id,
-                        file_func_name=configs._bstrap_file_hierarchy_fn_data_name,
-                        show_tags="true" if configs.treeViewBootstrapUseBadgeTags else "false",
-                        collapse_icon=configs.treeViewBootstrapCollapseIcon,
-                        expand_icon=configs.treeViewBootstrapExpandIcon,
-                        levels=configs.treeViewBootstrapLevels,
-                        onhover_color=configs.treeViewBootstrapOnhoverColor
+                        icon_mimic=self.configs.treeViewBootstrapIconMimicColor,
+                        page_idx=self.configs._page_hierarchy_id,
+                        page_func_name=self.configs._bstrap_page_hierarchy_fn_data_name,
+                        class_idx=self.configs._class_hierarchy_id,
+                        class_func_name=self.configs._bstrap_class_hierarchy_fn_data_name,
+                        file_idx=self.configs._file_hierarchy_id,
+                        file_func_name=self.configs._bstrap_file_hierarchy_fn_data_name,
+                        show_tags="true" if self.configs.treeViewBootstrapUseBadgeTags else "false",
+                        collapse_icon=self.configs.treeViewBootstrapCollapseIcon,
+                        expand_icon=self.configs.treeViewBootstrapExpandIcon,
+                        levels=self.configs.treeViewBootstrapLevels,
+                        onhover_color=self.configs.treeViewBootstrapOnhoverColor
                     )))
         except:
             utils.fancyError(
@@ -3780,28 +4741,31 @@ class ExhaleRoot(object):
         :func:`~exhale.graph.ExhaleRoot.generateAPIRootBody`.
         '''
         # gather the page hierarchy data and write it out
-        page_view_data = self.generatePageView()
+        with self.metrics.phase("generatePageView"):
+            page_view_data = self.generatePageView()
         self.writeOutHierarchy({
-            "idx": configs._page_hierarchy_id,
-            "bstrap_data_func_name": configs._bstrap_page_hierarchy_fn_data_name,
+            "idx": self.configs._page_hierarchy_id,
+            "bstrap_data_func_name": self.configs._bstrap_page_hierarchy_fn_data_name,
             "file_name": self.page_hierarchy_file,
-            "file_title": configs.pageHierarchySubSectionTitle,
+            "file_title": self.configs.pageHierarchySubSectionTitle,
             "type": "page"
         }, page_view_data)
         # gather the class hierarchy data and write it out
-        class_view_data = self.generateClassView()
+        with self.metrics.phase("generateClassView"):
+            class_view_data = self.generateClassView()
         self.writeOutHierarchy({
-            "idx": configs._class_hierarchy_id,
-            "bstrap_data_func_name": configs._bstrap_class_hierarchy_fn_data_name,
+            "idx": self.configs._class_hierarchy_id,
+            "bstrap_data_func_name": self.configs._bstrap_class_hierarchy_fn_data_name,
             "file_name": self.class_hierarchy_file,
             "file_title": "Class Hierarchy",
             "type": "class"
         }, class_view_data)
         # gather the file hierarchy data and write it out
-        file_view_data = self.generateDirectoryView()
+        with self.metrics.phase("generateDirectoryView"):
+            file_view_data = self.generateDirectoryView()
         self.writeOutHierarchy({
-            "idx": configs._file_hierarchy_id,
-            "bstrap_data_func_name": configs._bstrap_file_hierarchy_fn_data_name,
+            "idx": self.configs._file_hierarchy_id,
+            "bstrap_data_func_name": self.configs._bstrap_file_hierarchy_fn_data_name,
             "file_name": self.file_hierarchy_file,
             "file_title": "File Hierarchy",
             "type": "file"
@@ -3809,7 +4773,7 @@ class ExhaleRoot(object):
 
     def writeOutHierarchy(self, hierarchy_config, data):
         # inject the raw html for the treeView unordered lists
-        if configs.createTreeView:
+        if self.configs.createTreeView:
             # Cheap minification.  The `data` string is either
             #
             # 1. The interior of an HTML <ul> ... </ul> (collapsible lists)
@@ -3818,12 +4782,12 @@ class ExhaleRoot(object):
             # In either case, the data is currently well-formatted, no "surprise"
             # newlines should appear, etc.  So we can just split the lines and strip
             # the leading indentation.
-            if configs.minifyTreeView:
+            if self.configs.minifyTreeView:
                 data = "".join([line.strip() for line in data.splitlines()])
                 # For the bootstrap version we can also further eliminate some extra
                 # spaces between colons and their mapped value, and delete some
                 # erroneous commas that don't hurt but don't help ;)
-                if configs.treeViewIsBootstrap:
+                if self.configs.treeViewIsBootstrap:
                     data = data.replace(': ', ':').replace(",}", "}").replace(",,", ",").replace(",]", "]")
 
             if data:
@@ -3833,7 +4797,7 @@ class ExhaleRoot(object):
                 idx = hierarchy_config["idx"]
 
                 final_data_stream = StringIO()
-                if configs.treeViewIsBootstrap:
+                if self.configs.treeViewIsBootstrap:
                     func_name = hierarchy_config["bstrap_data_func_name"]
                     # developer note: when using string formatting with {curly_braces}, if
                     # you want a literal curly brace you escape it with curly braces.  so
@@ -3891,7 +4855,7 @@ class ExhaleRoot(object):
         # write everything to file to be incorporated with `.. include::` later
         try:
             if final_data_string:
-                with codecs.open(file_name, "w", "utf-8") as hierarchy_file:
+                with self.openGeneratedDocument(file_name) as hierarchy_file:
                     file_title = hierarchy_config["file_title"]
                     hierarchy_file.write(textwrap.dedent('''
                         {heading}
@@ -3955,7 +4919,7 @@ class ExhaleRoot(object):
             for m in missing:
                 m.toHierarchy("class", 0, class_view_stream, idx == last_missing_child)
                 idx += 1
-        elif configs.createTreeView:
+        elif self.configs.createTreeView:
             # need to restart since there were no missing children found, otherwise the
             # last namespace will not correctly have a lastChild
             class_view_stream.close()
@@ -3993,7 +4957,7 @@ class ExhaleRoot(object):
             for m in missing:
                 m.toHierarchy("file", 0, file_view_stream, idx == last_missing_child)
                 idx += 1
-        elif configs.createTreeView:
+        elif self.configs.createTreeView:
             # need to restart since there were no missing children found, otherwise the
             # last directory will not correctly have a lastChild
             file_view_stream.close()
@@ -4058,9 +5022,9 @@ class ExhaleRoot(object):
             def __getitem__(self, key):
                 k = self._key(key)
                 if k not in self.items:
-                    sys.stderr.write(utils.critical(
-                        "Unabridged API: unexpected kind '{}' (IGNORED)\n".format(key)
-                    ))
+                    logger.warning(utils.critical(
+                        "Unabridged API: unexpected kind '{}' (IGNORED)".format(key)
+                    ), type="exhale", subtype="unabridged")
                     self.items[k] = []
                 return self.items[k]
 
@@ -4095,9 +5059,9 @@ class ExhaleRoot(object):
                     {heading}
                     {heading_mark}
                 '''.format(
-                    heading=configs.fullApiSubSectionTitle,
+                    heading=self.configs.fullApiSubSectionTitle,
                     heading_mark=utils.heading_mark(
-                        configs.fullApiSubSectionTitle,
+                        self.configs.fullApiSubSectionTitle,
                         configs.SECTION_HEADING_CHAR if is_orphan
                         else configs.SUB_SECTION_HEADING_CHAR
                     )
@@ -4120,16 +5084,16 @@ class ExhaleRoot(object):
                 node_list = unabridged_specs[kind]
                 # Write to orphan_api if this kind is to be ignored, or the kind is
                 # "class" and "struct" was ignored (stored together).
-                if kind in configs.unabridgedOrphanKinds or \
-                        (kind == "class" and "struct" in configs.unabridgedOrphanKinds) or \
-                        (kind == "struct" and "class" in configs.unabridgedOrphanKinds):
+                if kind in self.configs.unabridgedOrphanKinds or \
+                        (kind == "class" and "struct" in self.configs.unabridgedOrphanKinds) or \
+                        (kind == "struct" and "class" in self.configs.unabridgedOrphanKinds):
                     dest = orphan_api
                 else:
                     dest = unabridged_api
                 self.enumerateAll(title, node_list, dest)
 
             # Write out the unabridged api file (gets included to root).
-            with codecs.open(self.unabridged_api_file, "w", "utf-8") as full_api_file:
+            with self.openGeneratedDocument(self.unabridged_api_file) as full_api_file:
                 full_api_file.write(unabridged_api.getvalue())
 
             # If the orphan file has any .. toctree:: in there, then we want to make
@@ -4137,7 +5101,7 @@ class ExhaleRoot(object):
             # we want Sphinx to be convinced that they show up in a toctree somewhere.
             orphan_api_value = orphan_api.getvalue()
             if "toctree" in orphan_api_value:
-                with codecs.open(self.unabridged_orphan_file, "w", "utf-8") as orphan_file:
+                with self.openGeneratedDocument(self.unabridged_orphan_file) as orphan_file:
                     orphan_file.write(orphan_api_value)
         except:
             utils.fancyError("Error writing the unabridged API.")
@@ -4180,7 +5144,7 @@ class ExhaleRoot(object):
 
                        {file}
                 '''.format(
-                    depth=configs.fullToctreeMaxDepth,
+                    depth=self.configs.fullToctreeMaxDepth,
                     file=l.file_name
                 )))
 
@@ -4295,7 +5259,7 @@ class ExhaleRoot(object):
             ``lst`` (list)
                 The list of ExhaleNodes to print to the console.
         '''
-        if not configs.verboseBuild:
+        if not self.configs.verboseBuild:
             return
 
         utils.verbose_log(textwrap.dedent('''
@@ -0,0 +1,839 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+'''
+The ``metrics`` module records what each phase of generating a project cost: how long
+it took, and how many files were opened, bytes read, documents parsed, and pages
+written during it.  Optionally, it also attributes the cost of parsing and generating
+to each compound, see :data:`~exhale.configs.compoundCostReport`.
+
+When :data:`~exhale.configs.traceFile` is set, every phase (as well as the Doxygen
+subprocess, every project, and every worker process) is also recorded as a span of a
+:class:`Trace`, to be viewed on a timeline with ``chrome://tracing`` or Perfetto.  When
+:data:`~exhale.configs.memoryProfileFile` is set, a :class:`MemoryProfile` records the
+memory in use at the end of every phase.
+
+The phases are the stages of :func:`~exhale.graph.ExhaleRoot.parse` and
+:func:`~exhale.graph.ExhaleRoot.generateFullAPI` (as well as running Doxygen), each
+opened with :func:`BuildMetrics.phase`.  The result is available as
+``app.exhale_root.metrics`` after the build, and written to
+:data:`~exhale.configs.metricsFile` when it is set.
+'''
+
+from __future__ import unicode_literals
+
+import codecs
+import contextlib
+import heapq
+import json
+import os
+import sys
+import threading
+import time
+import tracemalloc
+
+__all__ = [
+    "BuildMetrics", "COUNTERS", "COMPOUND_COSTS", "DOCUMENT_IO", "current", "count", "read",
+    "parsed", "recording", "reset", "compoundLocation", "Trace", "trace", "startTrace", "stopTrace", "span",
+    "MemoryProfile", "MEMORY_TOP_SITES", "peakRSS", "currentRSS"
+]
+
+
+COUNTERS = (
+    "files_opened", "bytes_read", "documents_parsed", "pages_written", "bytes_written", "doxygen_warnings"
+)
+'''
+The counters of :class:`BuildMetrics`, each phase reports how much they grew while it
+was open:
+
+``files_opened``
+    Doxygen XML documents (or archive members) read.
+
+``bytes_read``
+    Their size.
+
+``documents_parsed``
+    Doxygen XML documents parsed with BeautifulSoup.
+
+``pages_written``
+    Documents (including placeholders and hierarchies) written.
+
+``bytes_written``
+    The size of the written documents.
+
+``doxygen_warnings``
+    Warnings and errors Doxygen reported (see :class:`~exhale.deploy.DoxygenOutput`).
+'''
+
+COMPOUND_COSTS = ("parse_seconds", "parse_bytes", "generate_seconds", "generate_bytes")
+'''
+The costs :func:`BuildMetrics.compound` attributes to every compound, the report ranks
+the compounds by each of them:
+
+``parse_seconds``
+    Reading and parsing the ``{refid}.xml`` document (every time it was parsed).
+
+``parse_bytes``
+    The size of the ``{refid}.xml`` document (every time it was parsed).
+
+``generate_seconds``
+    Generating the documents of the compound (including parsing, when the document is
+    only parsed while generating).
+
+``generate_bytes``
+    The size of the documents generated for the compound.
+'''
+
+DOCUMENT_IO = ("opened", "bytes_read", "parsed")
+'''
+What :class:`BuildMetrics` counts for every Doxygen XML document, see
+:func:`BuildMetrics.read` and :func:`BuildMetrics.parsed`:
+
+``opened``
+    How many times the document was read.
+
+``bytes_read``
+    The size of every read.
+
+``parsed``
+    How many times the document was parsed with BeautifulSoup.
+'''
+
+
+class BuildMetrics(object):
+    '''
+    The metrics of generating one project.
+
+    ``phases`` (list)
+        One :class:`python:dict` per phase, in the order they were opened.  The keys are
+        ``name``, ``depth`` (how many phases enclose it), ``seconds``, and every counter
+        in :data:`~exhale.metrics.COUNTERS` that changed while it was open.
+
+    ``counters`` (dict)
+        The total of every counter in :data:`~exhale.metrics.COUNTERS`.
+
+    ``documents`` (dict)
+        The :data:`~exhale.metrics.DOCUMENT_IO` of every Doxygen XML document that was
+        read or parsed, keyed by file name (e.g. ``"index.xml"`` or ``"classfoo.xml"``).
+
+    ``compounds`` (dict or None)
+        The :data:`~exhale.metrics.COMPOUND_COSTS` of every compound keyed by refid, or
+        ``None`` unless :func:`~exhale.metrics.BuildMetrics.trackCompounds` was called.
+
+    ``memory`` (MemoryProfile or None)
+        Set while the memory of every phase is being profiled, see
+        :func:`~exhale.metrics.BuildMetrics.profileMemory`.
+    '''
+    def __init__(self):
+        self.phases        = []
+        self.counters      = dict.fromkeys(COUNTERS, 0)
+        self.documents     = {}
+        self.compounds     = None
+        self.top_compounds = 0
+        self.memory        = None
+        self._depth        = 0
+
+    def count(self, counter, amount=1):
+        '''
+        Add ``amount`` to the ``counter`` (one of :data:`~exhale.metrics.COUNTERS`).
+        '''
+        self.counters[counter] += amount
+
+    def _document(self, document):
+        io = self.documents.get(document, None)
+        if io is None:
+            io = self.documents[document] = dict.fromkeys(DOCUMENT_IO, 0)
+        return io
+
+    def read(self, document, size):
+        '''
+        Count reading ``size`` bytes of the Doxygen XML ``document``, in both
+        ``counters`` and ``documents``.
+
+        :Parameters:
+            ``document`` (str)
+                The file name of the document, e.g. ``"classfoo.xml"``.
+
+            ``size`` (int)
+                How many bytes were read.
+        '''
+        self.counters["files_opened"] += 1
+        self.counters["bytes_read"] += size
+        io = self._document(document)
+        io["opened"] += 1
+        io["bytes_read"] += size
+
+    def parsed(self, document):
+        '''
+        Count parsing the Doxygen XML ``document`` (e.g. ``"classfoo.xml"``), in both
+        ``counters`` and ``documents``.
+        '''
+        self.counters["documents_parsed"] += 1
+        self._document(document)["parsed"] += 1
+
+    def ioViolations(self, max_opened=None, max_parsed=None, max_bytes_read=None, ignore=()):
+        '''
+        Check the Doxygen XML read and parsed so far against a budget, every limit that
+        is ``None`` is not checked.
+
+        :Parameters:
+            ``max_opened`` (int or None)
+                How many times any one document may be read.
+
+            ``max_parsed`` (int or None)
+                How many times any one document may be parsed.
+
+            ``max_bytes_read`` (int, float, or None)
+                How many bytes may be read in total, e.g. ``1.1`` times
+                :func:`~exhale.utils.doxygenXMLSize` to allow reading little more than
+                the whole output once.
+
+            ``ignore`` (iterable of str)
+                Documents exempt from ``max_opened`` and ``max_parsed``.
+
+        :Return (list):
+            A description of every limit that was exceeded, empty when within budget.
+        '''
+        violations = []
+        ignore = set(ignore)
+        for document in sorted(self.documents):
+            if document in ignore:
+                continue
+            io = self.documents[document]
+            if max_opened is not None and io["opened"] > max_opened:
+                violations.append("[{0}] was read {1} times (at most {2} allowed).".format(
+                    document, io["opened"], max_opened
+                ))
+            if max_parsed is not None and io["parsed"] > max_parsed:
+                violations.append("[{0}] was parsed {1} times (at most {2} allowed).".format(
+                    document, io["parsed"], max_parsed
+                ))
+        if max_bytes_read is not None and self.counters["bytes_read"] > max_bytes_read:
+            violations.append("{0} bytes were read (at most {1} allowed).".format(
+                self.counters["bytes_read"], int(max_bytes_read)
+            ))
+        return violations
+
+    def assertIOBudget(self, **budget):
+        '''
+        Raise an ``AssertionError`` listing every limit that was exceeded, for tests.  The
+        keyword arguments are those of :func:`~exhale.metrics.BuildMetrics.ioViolations`.
+
+        .. code-block:: py
+
+           root.metrics.assertIOBudget(
+               max_opened=1, max_parsed=1, max_bytes_read=1.1 * utils.doxygenXMLSize()
+           )
+        '''
+        violations = self.ioViolations(**budget)
+        if violations:
+            raise AssertionError("The I/O budget was exceeded:\n  " + "\n  ".join(violations))
+
+    @contextlib.contextmanager
+    def phase(self, name):
+        '''
+        Record the phase ``name`` while the ``with`` block is running.
+
+        .. code-block:: py
+
+           with self.metrics.phase("fileRefDiscovery"):
+               self.fileRefDiscovery()
+
+        :Parameters:
+            ``name`` (str)
+                The name of the phase, usually the method that implements it.
+        '''
+        entry = {"name": name, "depth": self._depth}
+        self.phases.append(entry)
+        before = dict(self.counters)
+        self._depth += 1
+        if self.memory is not None:
+            self.memory.open()
+        start = time.perf_counter()
+        try:
+            yield entry
+        finally:
+            end = time.perf_counter()
+            entry["seconds"] = end - start
+            self._depth -= 1
+            for counter in COUNTERS:
+                if self.counters[counter] != before[counter]:
+                    entry[counter] = self.counters[counter] - before[counter]
+            if self.memory is not None:
+                self.memory.close(entry)
+            if _trace is not None:
+                args = {k: v for k, v in entry.items() if k not in ("name", "depth", "seconds")}
+                _trace.complete(name, "phase", start, end, args)
+
+    def record(self, name, start, end, **extra):
+        '''
+        Record the phase ``name`` that was timed elsewhere (e.g., one of the phases of
+        the Doxygen subprocess), nested in the phases that are open now.
+
+        :Parameters:
+            ``name`` (str)
+                The name of the phase.
+
+            ``start`` (float)
+                The :func:`python:time.perf_counter` value the phase started at.
+
+            ``end`` (float)
+                The :func:`python:time.perf_counter` value the phase ended at.
+
+            ``extra``
+                Added to the entry (and the span, when tracing).
+
+        :Return (dict):
+            The entry appended to ``phases``.
+        '''
+        entry = {"name": name, "depth": self._depth, "seconds": end - start}
+        entry.update(extra)
+        self.phases.append(entry)
+        if _trace is not None:
+            _trace.complete(name, "phase", start, end, dict(extra))
+        return entry
+
+    def profileMemory(self):
+        '''
+        Start profiling the memory of every phase opened from now on, see
+        :class:`~exhale.metrics.MemoryProfile`.
+        '''
+        if self.memory is None:
+            self.memory = MemoryProfile()
+
+    def stopProfilingMemory(self):
+        '''
+        Stop profiling memory.
+
+        :Return (MemoryProfile or None):
+            The profile that was being recorded.
+        '''
+        memory = self.memory
+        if memory is not None:
+            memory.stop()
+        self.memory = None
+        return memory
+
+    def trackCompounds(self, top):
+        '''
+        Start attributing costs to compounds in
+        :func:`~exhale.metrics.BuildMetrics.compound`.
+
+        :Parameters:
+            ``top`` (int)
+                How many compounds :func:`~exhale.metrics.BuildMetrics.compoundReport`
+                lists for each cost.
+        '''
+        if self.compounds is None:
+            self.compounds = {}
+        self.top_compounds = top
+
+    @contextlib.contextmanager
+    def compound(self, node, stage):
+        '''
+        Attribute the time spent in the ``with`` block to ``node``.  Nothing is recorded
+        (and ``None`` is yielded) unless compounds are being tracked.
+
+        .. code-block:: py
+
+           with self.metrics.compound(node, "parse") as cost:
+               contents = self.compoundXMLContents(node)
+               if cost is not None:
+                   cost["bytes"] = len(contents)
+
+        :Parameters:
+            ``node`` (ExhaleNode)
+                The compound being parsed or generated.
+
+            ``stage`` (str)
+                Either ``"parse"`` or ``"generate"``.  For ``"generate"``, the bytes
+                written while the block is open are added automatically.  For
+                ``"parse"``, the block sets ``cost["bytes"]`` to the size of what it
+                parsed, and nothing is recorded when it parsed nothing.
+        '''
+        if self.compounds is None:
+            yield None
+            return
+        cost = {"bytes": 0}
+        written = self.counters["bytes_written"]
+        start = time.perf_counter()
+        try:
+            yield cost
+        finally:
+            seconds = time.perf_counter() - start
+            written = self.counters["bytes_written"] - written
+            if stage == "generate" or cost["bytes"]:
+                entry = self.compounds.get(node.refid, None)
+                if entry is None:
+                    entry = {
+                        "refid": node.refid,
+                        "kind": node.kind,
+                        "name": node.name,
+                        "location": compoundLocation(node)
+                    }
+                    entry.update(dict.fromkeys(COMPOUND_COSTS, 0))
+                    self.compounds[node.refid] = entry
+                entry[stage + "_seconds"] += seconds
+                entry[stage + "_bytes"] += cost["bytes"] + written
+
+    def compoundReport(self):
+        '''
+        :Return (dict):
+            For each cost in :data:`~exhale.metrics.COMPOUND_COSTS`, the ``top_compounds``
+            most expensive compounds (most expensive first).  Each is the
+            :class:`python:dict` of ``refid``, ``kind``, ``name``, ``location`` and every
+            cost.  Empty when compounds are not being tracked.
+        '''
+        if not self.compounds:
+            return {}
+        return {
+            cost: heapq.nlargest(self.top_compounds, self.compounds.values(), key=lambda e: e[cost])
+            for cost in COMPOUND_COSTS
+        }
+
+    def formatCompoundReport(self):
+        '''
+        :Return (str):
+            :func:`~exhale.metrics.BuildMetrics.compoundReport` as a plain text table per
+            cost, as printed at the end of :func:`~exhale.deploy.explode`.
+        '''
+        lines = []
+        for cost, entries in self.compoundReport().items():
+            lines.append("The {0} most expensive compounds by {1}:".format(len(entries), cost))
+            for e in entries:
+                value = "{0:.4f}".format(e[cost]) if cost.endswith("seconds") else "{0}".format(e[cost])
+                lines.append("    {0:>12}  {1:<10} {2}  {3}".format(
+                    value, e["kind"], e["refid"], e["location"] or "(no location)"
+                ))
+        return "\n".join(lines)
+
+    def seconds(self, name):
+        '''
+        :Return (float):
+            The total time spent in every phase named ``name``.
+        '''
+        return sum(p["seconds"] for p in self.phases if p["name"] == name and "seconds" in p)
+
+    def asDict(self):
+        '''
+        :Return (dict):
+            The ``phases`` and ``counters`` (and ``compounds``, the
+            :func:`~exhale.metrics.BuildMetrics.compoundReport`, when compounds are
+            being tracked), as written by :func:`~exhale.metrics.BuildMetrics.writeJSON`.
+        '''
+        contents = {"phases": self.phases, "counters": self.counters}
+        if self.compounds is not None:
+            contents["compounds"] = self.compoundReport()
+        return contents
+
+    def writeJSON(self, path, **extra):
+        '''
+        Write :func:`~exhale.metrics.BuildMetrics.asDict` to ``path``.
+
+        :Parameters:
+            ``path`` (str)
+                The file to write, its directory is created if needed.
+
+            ``extra``
+                Additional top-level keys, e.g., the ``project``.
+        '''
+        contents = dict(extra)
+        contents.update(self.asDict())
+        directory = os.path.dirname(os.path.abspath(path))
+        if not os.path.isdir(directory):
+            os.makedirs(directory)
+        with codecs.open(path, "w", "utf-8") as metrics_file:
+            json.dump(contents, metrics_file, indent=2)
+            metrics_file.write("\n")
+
+
+class Trace(object):
+    '''
+    Spans in the Chrome trace event format (``chrome://tracing`` and Perfetto both
+    read it).  Each span is a complete (``"ph": "X"``) event on the track of the
+    process and thread that recorded it, so the worker processes of
+    :func:`~exhale.deploy.explodeProjects` appear as their own tracks.
+
+    :Parameters:
+        ``origin`` (float or ``None``)
+            The :func:`python:time.perf_counter` value timestamps are relative to.
+            Worker processes pass the origin of the trace they were forked from so that
+            their spans line up, the clock is shared between processes.
+    '''
+    def __init__(self, origin=None):
+        self.origin = time.perf_counter() if origin is None else origin
+        self.events = []
+
+    def complete(self, name, category, start, end, args=None):
+        '''
+        Record the span ``name`` from ``start`` to ``end``.
+
+        :Parameters:
+            ``name`` (str)
+                The name shown on the span.
+
+            ``category`` (str)
+                The category of the span, e.g., ``"phase"`` or ``"subprocess"``.
+
+            ``start`` (float)
+                The :func:`python:time.perf_counter` value the span started at.
+
+            ``end`` (float)
+                The :func:`python:time.perf_counter` value the span ended at.
+
+            ``args`` (dict or ``None``)
+                Values shown when the span is selected.
+        '''
+        event = {
+            "name": name,
+            "cat": category,
+            "ph": "X",
+            "ts": (start - self.origin) * 1e6,
+            "dur": (end - start) * 1e6,
+            "pid": os.getpid(),
+            "tid": threading.get_ident()
+        }
+        if args:
+            event["args"] = args
+        self.events.append(event)
+
+    def nameProcess(self, name):
+        '''
+        Label the track of this process ``name``, e.g., the project a worker generates.
+        '''
+        self.events.append({
+            "name": "process_name", "ph": "M", "pid": os.getpid(), "args": {"name": name}
+        })
+
+    def writeJSON(self, path):
+        '''
+        Write the trace to ``path`` (its directory is created if needed).
+        '''
+        directory = os.path.dirname(os.path.abspath(path))
+        if not os.path.isdir(directory):
+            os.makedirs(directory)
+        with codecs.open(path, "w", "utf-8") as trace_file:
+            json.dump({"traceEvents": self.events, "displayTimeUnit": "ms"}, trace_file)
+            trace_file.write("\n")
+
+
+MEMORY_TOP_SITES = 10
+''' How many allocation sites :class:`~exhale.metrics.MemoryProfile` lists per phase. '''
+
+
+def peakRSS():
+    '''
+    :Return (int or None):
+        The largest resident set size of this process so far, in bytes.  ``None`` where
+        :mod:`python:resource` is not available (Windows).
+    '''
+    try:
+        import resource
+    except ImportError:
+        return None
+    peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # Reported in bytes on macOS, and in kibibytes everywhere else.
+    return peak if sys.platform == "darwin" else peak * 1024
+
+
+def currentRSS():
+    '''
+    :Return (int or None):
+        The resident set size of this process, in bytes.  ``None`` where
+        ``/proc/self/statm`` is not available (anywhere but Linux).
+    '''
+    try:
+        with open("/proc/self/statm") as statm:
+            return int(statm.read().split()[1]) * os.sysconf("SC_PAGE_SIZE")
+    except (OSError, ValueError, IndexError, AttributeError):
+        return None
+
+
+# Python 3.8 cannot reset the peak, every phase then reports the peak so far.
+_reset_peak = getattr(tracemalloc, "reset_peak", lambda: None)
+
+
+def _mebibytes(size):
+    return "-" if size is None else "{0:.1f} MiB".format(size / (1024.0 * 1024.0))
+
+
+class MemoryProfile(object):
+    '''
+    The memory in use at the end of every phase of a :class:`BuildMetrics`, traced with
+    :mod:`python:tracemalloc` (which is started if it is not already tracing).  Every
+    phase gets these keys:
+
+    ``traced_peak``
+        The most memory traced while the phase was open, in bytes (on Python 3.8, the
+        most traced so far).
+
+    ``traced_current``
+        The memory traced when the phase ended, in bytes.
+
+    ``peak_rss``
+        The largest resident set size of the process so far (see
+        :func:`~exhale.metrics.peakRSS`), when known.  It grows during the phase that
+        allocated the most.
+
+    ``rss``
+        The resident set size when the phase ended (see
+        :func:`~exhale.metrics.currentRSS`), when known.
+
+    In addition, ``sites`` lists the :data:`~exhale.metrics.MEMORY_TOP_SITES` source
+    lines holding the most memory when each phase ended.  Tracing makes the build
+    considerably slower, this is meant for finding out what runs out of memory.
+    '''
+    # Allocations made by tracemalloc (e.g., taking the snapshots) are not the build's.
+    _FILTERS = (
+        tracemalloc.Filter(False, tracemalloc.__file__),
+        tracemalloc.Filter(False, "<frozen importlib._bootstrap>"),
+        tracemalloc.Filter(False, "<unknown>")
+    )
+
+    def __init__(self, top=MEMORY_TOP_SITES):
+        self.top = top
+        self.sites = []
+        # The traced peak of every open phase so far, since phases nest but there is
+        # only one peak to reset.
+        self._peaks = []
+        self._started = not tracemalloc.is_tracing()
+        if self._started:
+            tracemalloc.start()
+
+    def _foldPeak(self):
+        # Every open phase saw the peak since the last boundary.
+        peak = tracemalloc.get_traced_memory()[1]
+        self._peaks = [max(open_peak, peak) for open_peak in self._peaks]
+        _reset_peak()
+
+    def open(self):
+        '''Called by :func:`BuildMetrics.phase` when a phase is opened.'''
+        self._foldPeak()
+        self._peaks.append(0)
+
+    def close(self, entry):
+        '''Called by :func:`BuildMetrics.phase` to add the memory to the ``entry``.'''
+        self._foldPeak()
+        entry["traced_peak"]    = self._peaks.pop()
+        entry["traced_current"] = tracemalloc.get_traced_memory()[0]
+        peak_rss = peakRSS()
+        if peak_rss is not None:
+            entry["peak_rss"] = peak_rss
+        rss = currentRSS()
+        if rss is not None:
+            entry["rss"] = rss
+
+        snapshot = tracemalloc.take_snapshot().filter_traces(self._FILTERS)
+        sites = []
+        for stat in snapshot.statistics("lineno")[:self.top]:
+            frame = stat.traceback[0]
+            sites.append({
+                "site": "{0}:{1}".format(frame.filename, frame.lineno),
+                "size": stat.size,
+                "count": stat.count
+            })
+        self.sites.append((entry["name"], sites))
+        del snapshot
+        # Taking the snapshot is not part of the enclosing phase.
+        _reset_peak()
+
+    def stop(self):
+        '''Stop tracing, unless it was already tracing before this profile started.'''
+        if self._started and tracemalloc.is_tracing():
+            tracemalloc.stop()
+        self._started = False
+
+    def writeReport(self, path, phases, project):
+        '''
+        Write a plain text summary of the memory of every phase.
+
+        :Parameters:
+            ``path`` (str)
+                The file to write, its directory is created if needed.
+
+            ``phases`` (list)
+                The ``phases`` of the :class:`~exhale.metrics.BuildMetrics` profiled.
+
+            ``project`` (str)
+                The project the report is for.
+        '''
+        lines = [
+            "Exhale memory profile of [{0}]".format(project),
+            "",
+            "{0:<40} {1:>12} {2:>12} {3:>12} {4:>12}".format(
+                "Phase", "Peak RSS", "RSS", "Traced", "Traced peak"
+            )
+        ]
+        for phase in phases:
+            if "traced_peak" not in phase:
+                continue  # e.g., running Doxygen, before profiling started
+            lines.append("{0:<40} {1:>12} {2:>12} {3:>12} {4:>12}".format(
+                "  " * phase["depth"] + phase["name"],
+                _mebibytes(phase.get("peak_rss", None)),
+                _mebibytes(phase.get("rss", None)),
+                _mebibytes(phase["traced_current"]),
+                _mebibytes(phase["traced_peak"])
+            ))
+        lines.extend(["", "Top allocation sites at the end of every phase:"])
+        for name, sites in self.sites:
+            lines.extend(["", name])
+            for site in sites:
+                lines.append("    {0:>12}  {1} ({2} blocks)".format(
+                    _mebibytes(site["size"]), site["site"], site["count"]
+                ))
+
+        directory = os.path.dirname(os.path.abspath(path))
+        if not os.path.isdir(directory):
+            os.makedirs(directory)
+        with codecs.open(path, "w", "utf-8") as report:
+            report.write("\n".join(lines))
+            report.write("\n")
+
+
+def compoundLocation(node):
+    '''
+    :Return (str):
+        The ``location`` of the file (or page) ``node`` is, or is defined in, or that of
+        its closest parent.  Empty when none is known.
+    '''
+    walk = node
+    while walk is not None:
+        location = getattr(walk, "location", "")
+        if location:
+            return location
+        if walk.def_in_file is not None and walk.def_in_file.location:
+            return walk.def_in_file.location
+        walk = walk.parent
+    return ""
+
+
+# The metrics of the project being generated in this process.  Doxygen runs before the
+# ExhaleRoot exists, so the root adopts whatever was recorded up to that point.
+_current = BuildMetrics()
+
+
+def current():
+    '''
+    :Return (BuildMetrics):
+        The metrics of the project currently being generated in this process.
+    '''
+    return _current
+
+
+def count(counter, amount=1):
+    '''Add ``amount`` to ``counter`` of :func:`~exhale.metrics.current`.'''
+    _current.counters[counter] += amount
+
+
+def read(document, size):
+    '''See :func:`~exhale.metrics.BuildMetrics.read`, of :func:`~exhale.metrics.current`.'''
+    _current.read(document, size)
+
+
+def parsed(document):
+    '''See :func:`~exhale.metrics.BuildMetrics.parsed`, of :func:`~exhale.metrics.current`.'''
+    _current.parsed(document)
+
+
+# The trace being recorded, None unless configs.traceFile is set.  Every span checks
+# this first, so tracing costs nothing else when it is disabled.
+_trace = None
+
+
+def trace():
+    '''
+    :Return (Trace or None):
+        The trace being recorded, or ``None`` when tracing is disabled.
+    '''
+    return _trace
+
+
+def startTrace(origin=None):
+    '''
+    Start recording a new :class:`~exhale.metrics.Trace` (replacing the current one).
+
+    :Parameters:
+        ``origin`` (float or ``None``)
+            See :class:`~exhale.metrics.Trace`.
+
+    :Return (Trace):
+        The new trace.
+    '''
+    global _trace
+    _trace = Trace(origin)
+    return _trace
+
+
+def stopTrace():
+    '''
+    Stop tracing.
+
+    :Return (Trace or None):
+        The trace that was being recorded.
+    '''
+    global _trace
+    stopped = _trace
+    _trace = None
+    return stopped
+
+
+@contextlib.contextmanager
+def span(name, category, **args):
+    '''
+    Record the ``with`` block as the span ``name`` of the current trace, for work that
+    is not a phase of :class:`~exhale.metrics.BuildMetrics` (e.g., the Doxygen
+    subprocess, or a worker process).  Does nothing when tracing is disabled.
+
+    :Parameters:
+        ``name`` (str)
+            The name shown on the span.
+
+        ``category`` (str)
+            The category of the span.
+
+        ``args``
+            Values shown when the span is selected.
+    '''
+    if _trace is None:
+        yield
+        return
+    start = time.perf_counter()
+    try:
+        yield
+    finally:
+        if _trace is not None:
+            _trace.complete(name, category, start, time.perf_counter(), args)
+
+
+def reset():
+    '''
+    Start recording a new project, called by :func:`~exhale.deploy.explode` once the
+    :class:`~exhale.graph.ExhaleRoot` it created has finished.
+    '''
+    global _current
+    _current = BuildMetrics()
+
+
+@contextlib.contextmanager
+def recording(build_metrics):
+    '''
+    Make ``build_metrics`` :func:`~exhale.metrics.current` for the ``with`` block, e.g.
+    so that documents rendered by
+    :func:`~exhale.graph.ExhaleRoot.renderOnDemandDocument` after
+    :func:`~exhale.deploy.explode` has finished are counted by the root they belong to.
+
+    :Parameters:
+        ``build_metrics`` (:class:`~exhale.metrics.BuildMetrics`)
+            The metrics to record to.
+    '''
+    global _current
+    previous = _current
+    _current = build_metrics
+    try:
+        yield build_metrics
+    finally:
+        _current = previous
@@ -12,9 +12,8 @@ from . import configs
 from . import utils
 
 import textwrap
-from bs4 import BeautifulSoup
 
-__all__       = ["walk", "convertDescriptionToRST", "getBriefAndDetailedRST"]
+__all__       = ["walk", "convertDescriptionToRST", "getBriefAndDetailedRST", "getMemberDescriptionRST"]
 
 
 def walk(textRoot, currentTag, level, prefix=None, postfix=None, unwrapUntilPara=False):
@@ -204,14 +203,14 @@ def getBriefAndDetailedRST(textRoot, node):
 
     .. todo:: actually document this
     '''
-    node_xml_contents = utils.nodeCompoundXMLContents(node)
-    if not node_xml_contents:
-        return "", ""
-
     try:
-        node_soup = BeautifulSoup(node_xml_contents, "lxml-xml")
+        node_soup = textRoot.parsedCompoundXML(node)
     except:
         utils.fancyError("Unable to parse [{0}] xml using BeautifulSoup".format(node.name))
+    if not node_soup:
+        return "", ""
+    # Converting the descriptions modifies the document, and nothing needs it after.
+    textRoot.releaseParsedXML([node.refid])
 
     try:
         # In the file xml definitions, things such as enums or defines are listed inside
@@ -241,3 +240,100 @@ def getBriefAndDetailedRST(textRoot, node):
         utils.fancyError(
             "Could not acquire soup.doxygen.compounddef; likely not a doxygen xml file."
         )
+
+
+PARAMETER_LIST_FIELDS = {
+    "param":         "param",
+    "templateparam": "tparam",
+    "exception":     "throws",
+    "retval":        "retval"
+}
+'''
+Maps the ``kind`` of a Doxygen ``<parameterlist>`` to the Sphinx info field used by
+:func:`~exhale.parse.getMemberDescriptionRST`.
+'''
+
+SIMPLESECT_DIRECTIVES = {
+    "attention": "attention",
+    "note":      "note",
+    "see":       "seealso",
+    "warning":   "warning"
+}
+'''
+Maps the ``kind`` of a Doxygen ``<simplesect>`` to the reStructuredText admonition used
+by :func:`~exhale.parse.getMemberDescriptionRST`.
+'''
+
+
+def _descriptionText(textRoot, node, soupTag):
+    if not soupTag or soupTag.get_text().isspace():
+        return ""
+    return textwrap.dedent(convertDescriptionToRST(textRoot, node, soupTag, None)).strip()
+
+
+def _infoField(name, text):
+    body = utils.indent(text, "   ").strip()
+    return ":{0}: {1}".format(name, body) if body else ":{0}:".format(name)
+
+
+def getMemberDescriptionRST(textRoot, node, memberdef):
+    '''
+    Convert the descriptions of a ``<memberdef>`` (or ``<enumvalue>``) to the content of
+    a Sphinx domain directive, used when :data:`~exhale.configs.nativeMemberRendering`
+    is ``True``.
+
+    The brief and detailed descriptions are converted with
+    :func:`~exhale.parse.convertDescriptionToRST`.  Parameter lists become info fields
+    (see :data:`~exhale.parse.PARAMETER_LIST_FIELDS`), ``\\return`` becomes
+    ``:returns:``, and the simple sections in
+    :data:`~exhale.parse.SIMPLESECT_DIRECTIVES` become admonitions.
+
+    .. note::
+
+       The descriptions in ``memberdef`` are modified in place.
+
+    **Parameters**
+        ``textRoot`` (:class:`~exhale.graph.ExhaleRoot`)
+            The text root object that is calling this method.
+
+        ``node`` (:class:`~exhale.graph.ExhaleNode`)
+            The node being documented.
+
+        ``memberdef`` (:class:`bs4.element.Tag`)
+            The ``<memberdef>`` or ``<enumvalue>`` tag describing ``node``.
+
+    **Return**
+        ``str``
+            The (unindented) directive content, possibly empty.
+    '''
+    fields      = []
+    admonitions = []
+    detailed    = memberdef.find("detaileddescription", recursive=False)
+    if detailed:
+        for parameterlist in detailed.find_all("parameterlist"):
+            field = PARAMETER_LIST_FIELDS.get(parameterlist.attrs.get("kind", None), "param")
+            for item in parameterlist.find_all("parameteritem", recursive=False):
+                text = _descriptionText(
+                    textRoot, node, item.find("parameterdescription", recursive=False)
+                )
+                for name in item.find_all("parametername"):
+                    fields.append(_infoField("{0} {1}".format(field, name.get_text().strip()), text))
+            parameterlist.extract()
+
+        for simplesect in detailed.find_all("simplesect"):
+            kind = simplesect.attrs.get("kind", None)
+            if kind == "return":
+                fields.append(_infoField("returns", _descriptionText(textRoot, node, simplesect)))
+                simplesect.extract()
+            elif kind in SIMPLESECT_DIRECTIVES:
+                admonitions.append(".. {0}::\n\n{1}".format(
+                    SIMPLESECT_DIRECTIVES[kind],
+                    utils.indent(_descriptionText(textRoot, node, simplesect), "   ")
+                ))
+                simplesect.extract()
+
+    parts = [
+        _descriptionText(textRoot, node, memberdef.find("briefdescription", recursive=False)),
+        _descriptionText(textRoot, node, detailed)
+    ] + admonitions + ["\n".join(fields)]
+    return "\n\n".join(part for part in parts if part)
@@ -0,0 +1,243 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+'''
+The ``storage`` module holds the bulky per-node data of an
+:class:`~exhale.graph.ExhaleRoot`: program listings, the includes of files, function
+signatures.  Which store is used is chosen by :data:`~exhale.configs.nodeDataStore`.
+
+The :class:`NodeDataStore` keeps everything in memory as plain lists.  The
+:class:`SQLiteNodeDataStore` writes it to a temporary SQLite database instead, and the
+nodes hold a :class:`StoredSequence` that reads the rows back each time it is
+iterated.  Either way the nodes are accessed the same, so the generated documents are
+identical.  The nodes themselves, and the edges between them, are always in memory.
+'''
+
+from __future__ import unicode_literals
+
+import os
+import sqlite3
+import tempfile
+from pathlib import Path
+
+__all__ = ["NodeDataStore", "SQLiteNodeDataStore", "StoredSequence", "makeNodeDataStore"]
+
+
+class StoredSequence(object):
+    '''
+    A read-only sequence whose items are rows of a :class:`SQLiteNodeDataStore` table.
+    Only the length is kept in memory, iterating streams the rows out of the database.
+
+    :Parameters:
+        ``store`` (SQLiteNodeDataStore)
+            The store the rows were written to.
+
+        ``table`` (str)
+            The table of ``store`` the rows are in.
+
+        ``refid`` (str)
+            The refid of the node the rows belong to.
+
+        ``length`` (int)
+            The number of rows.
+    '''
+    __slots__ = ("store", "table", "refid", "length")
+
+    def __init__(self, store, table, refid, length):
+        self.store  = store
+        self.table  = table
+        self.refid  = refid
+        self.length = length
+
+    def __len__(self):
+        return self.length
+
+    def __iter__(self):
+        return self.store.iterate(self.table, self.refid)
+
+    def __getitem__(self, index):
+        return list(self)[index]
+
+    def __eq__(self, other):
+        if isinstance(other, (StoredSequence, list, tuple)):
+            return list(self) == list(other)
+        return NotImplemented
+
+    def __ne__(self, other):
+        equal = self.__eq__(other)
+        return equal if equal is NotImplemented else not equal
+
+    __hash__ = None
+
+    def __repr__(self):
+        return "StoredSequence({0}, {1}, n={2})".format(self.table, self.refid, self.length)
+
+
+class NodeDataStore(object):
+    '''
+    The default in memory store, :data:`~exhale.configs.nodeDataStore` ``"memory"``.  The
+    values given to :func:`~exhale.storage.NodeDataStore.sequence` are returned unchanged.
+    '''
+    keep_parsed_xml = True
+    '''
+    Whether :func:`~exhale.graph.ExhaleRoot.parsedCompoundXML` may keep documents in
+    ``ExhaleRoot.parsed_xml`` for the later stages.
+    '''
+
+    def sequence(self, table, refid, values):
+        '''
+        Store ``values`` for the node ``refid``.
+
+        :Parameters:
+            ``table`` (str)
+                One of the keys of :data:`~exhale.storage.SQLiteNodeDataStore.TABLES`.
+
+            ``refid`` (str)
+                The refid of the node ``values`` belong to.
+
+            ``values`` (list)
+                The values, tuples for tables with more than one column.
+
+        :Return (list or StoredSequence):
+            What the node should keep as the attribute.
+        '''
+        return values
+
+    def commit(self):
+        '''Called after each parsing stage that stored values.'''
+        pass
+
+    def close(self):
+        '''
+        Release the store, the nodes may no longer be iterated.  Called by
+        :func:`~exhale.deploy.explode` once the documents are generated, or when the
+        Sphinx build finishes with :data:`~exhale.configs.onDemandGeneration`.
+        '''
+        pass
+
+
+class SQLiteNodeDataStore(NodeDataStore):
+    '''
+    The :data:`~exhale.configs.nodeDataStore` ``"sqlite"`` store.  The database is a
+    temporary file removed by :func:`~exhale.storage.SQLiteNodeDataStore.close`, only its
+    page cache is held in memory.
+
+    SQLite connections must not be used across ``fork()``, and with
+    :data:`~exhale.configs.onDemandGeneration` the documents are rendered in the forked
+    parallel read workers of Sphinx.  A forked process opens its own read only
+    connection to the database the first time it uses the store, see
+    :attr:`~exhale.storage.SQLiteNodeDataStore.connection`.
+    '''
+    keep_parsed_xml = False
+
+    TABLES = {
+        "program_listing": 1,
+        "includes":        1,
+        "included_by":     2,  # (refid, name)
+        "parameters":      1,
+        "template":        1
+    }
+    '''The table of each sequence attribute, and the number of value columns it has.'''
+
+    def __init__(self):
+        handle, self.path = tempfile.mkstemp(prefix="exhale_nodes_", suffix=".sqlite")
+        os.close(handle)
+        self._pid         = os.getpid()
+        self._owner_pid   = self._pid
+        self._connection  = sqlite3.connect(self.path)
+        self._inherited   = []
+        for table, columns in self.TABLES.items():
+            values = ", ".join("value{0} TEXT".format(c) for c in range(columns))
+            self._connection.execute(
+                "CREATE TABLE {0} (refid TEXT, position INTEGER, {1}, "
+                "PRIMARY KEY (refid, position)) WITHOUT ROWID".format(table, values)
+            )
+        self._connection.commit()
+
+    @property
+    def connection(self):
+        '''
+        The connection of this process.  In a process forked after the store was
+        created, a new read only connection (the rows committed before the fork are
+        visible), the inherited one is kept but never used or closed.
+        '''
+        pid = os.getpid()
+        if pid != self._pid:
+            self._inherited.append(self._connection)
+            self._connection = sqlite3.connect(Path(self.path).as_uri() + "?mode=ro", uri=True)
+            self._pid = pid
+        return self._connection
+
+    def sequence(self, table, refid, values):
+        if not values:
+            return values
+        columns = self.TABLES[table]
+        if columns == 1:
+            rows = ((refid, position, value) for position, value in enumerate(values))
+        else:
+            rows = ((refid, position) + tuple(value) for position, value in enumerate(values))
+        self.connection.executemany(
+            "INSERT OR REPLACE INTO {0} VALUES ({1})".format(table, ", ".join(["?"] * (columns + 2))),
+            rows
+        )
+        return StoredSequence(self, table, refid, len(values))
+
+    def iterate(self, table, refid):
+        '''
+        Stream the values :func:`~exhale.storage.SQLiteNodeDataStore.sequence` stored.
+
+        :Parameters:
+            ``table`` (str)
+                The table the values were stored in.
+
+            ``refid`` (str)
+                The refid of the node the values belong to.
+
+        :Return (generator):
+            The values in the order they were stored.
+        '''
+        columns = self.TABLES[table]
+        cursor = self.connection.execute(
+            "SELECT {0} FROM {1} WHERE refid = ? ORDER BY position".format(
+                ", ".join("value{0}".format(c) for c in range(columns)), table
+            ),
+            (refid,)
+        )
+        if columns == 1:
+            for row in cursor:
+                yield row[0]
+        else:
+            for row in cursor:
+                yield row
+
+    def commit(self):
+        self.connection.commit()
+
+    def close(self):
+        # Only the process that created the database removes it.
+        if os.getpid() != self._owner_pid or self._connection is None:
+            return
+        self._connection.close()
+        self._connection = None
+        try:
+            os.remove(self.path)
+        except OSError:
+            pass
+
+
+def makeNodeDataStore(kind):
+    '''
+    :Parameters:
+        ``kind`` (str)
+            The value of :data:`~exhale.configs.nodeDataStore`.
+
+    :Return (NodeDataStore):
+        The store to use for an :class:`~exhale.graph.ExhaleRoot`.
+    '''
+    if kind == "sqlite":
+        return SQLiteNodeDataStore()
+    return NodeDataStore()
@@ -10,19 +10,35 @@ from __future__ import unicode_literals, annotations
 from typing import TextIO, Union
 
 from . import configs
+from . import metrics
 
+import bz2
 import codecs
 from dataclasses import dataclass
 import datetime
+import enum
+import gzip
+import hashlib
 from io import StringIO
+import lzma
 import os
+import posixpath
 import re
+import shutil
 import sys
 import six
+import tarfile
+import tempfile
 import textwrap
 import time
 import traceback
 import types
+import weakref
+import zipfile
+
+from sphinx.util import logging
+
+logger = logging.getLogger(__name__)
 
 # Fancy error printing <3
 try:
@@ -156,8 +172,156 @@ CLASS_LIKE_KINDS = [
 ]
 """All kinds that are "class-like"."""
 
+MEMBER_KINDS = [
+    "define",
+    "enum",
+    "function",
+    "typedef",
+    "variable"
+]
+'''
+The kinds in :data:`LEAF_LIKE_KINDS` that Doxygen describes with a ``<memberdef>`` in the
+XML of the enclosing compound rather than with their own ``{refid}.xml``.  These can be
+rendered without Breathe, see :data:`~exhale.configs.nativeMemberRendering`.
+'''
+
+
+class Kind(enum.IntEnum):
+    '''
+    The integer code of every kind in :data:`AVAILABLE_KINDS`, stored by each
+    :class:`~exhale.graph.ExhaleNode` as ``kind_code``.  Any other kind Doxygen reports
+    (e.g., ``"example"``) is :attr:`Kind.UNKNOWN`.
 
-def contentsDirectiveOrNone(kind):
+    The ``KIND_*`` tables below are indexed by these codes, so that the graph can
+    dispatch on the kind of a node with one lookup rather than comparing strings.
+    '''
+    CLASS     = 0
+    DEFINE    = 1
+    DIR       = 2
+    ENUM      = 3
+    ENUMVALUE = 4
+    FILE      = 5
+    FUNCTION  = 6
+    GROUP     = 7
+    NAMESPACE = 8
+    STRUCT    = 9
+    TYPEDEF   = 10
+    UNION     = 11
+    VARIABLE  = 12
+    PAGE      = 13
+    UNKNOWN   = 14
+
+
+KIND_CODES = {kind: Kind[kind.upper()] for kind in AVAILABLE_KINDS}
+"""Maps every kind in :data:`AVAILABLE_KINDS` to its :class:`Kind`."""
+
+
+def kindCode(kind):
+    '''
+    :Parameters:
+        ``kind`` (str)
+            The kind of the node, as Doxygen reports it.
+
+    :Return (Kind):
+        The code of ``kind``, :attr:`Kind.UNKNOWN` when it is not in
+        :data:`AVAILABLE_KINDS`.
+    '''
+    return KIND_CODES.get(kind, Kind.UNKNOWN)
+
+
+def kindTable(values, default):
+    '''
+    Build a table indexed by :class:`Kind`.
+
+    :Parameters:
+        ``values`` (dict)
+            Maps a :class:`Kind` to its entry.
+
+        ``default``
+            The entry of every :class:`Kind` not in ``values``.
+
+    :Return (tuple):
+        One entry per :class:`Kind`, in code order.
+    '''
+    return tuple(values.get(code, default) for code in Kind)
+
+
+KIND_QUALIFIERS = tuple(
+    "Directory" if code == Kind.DIR else code.name.capitalize() for code in Kind
+)
+"""The :func:`qualifyKind` of each :class:`Kind`."""
+
+KIND_DIRECTIVES = tuple("doxygen{0}".format(code.name.lower()) for code in Kind)
+"""The :func:`kindAsBreatheDirective` of each :class:`Kind`."""
+
+KIND_IS_LEAF_LIKE = kindTable({KIND_CODES[kind]: True for kind in LEAF_LIKE_KINDS}, False)
+"""Whether each :class:`Kind` is in :data:`LEAF_LIKE_KINDS`."""
+
+KIND_IS_CLASS_LIKE = kindTable({Kind.CLASS: True, Kind.STRUCT: True}, False)
+"""Whether each :class:`Kind` is a class or struct."""
+
+KIND_IN_CLASS_HIERARCHY = kindTable(
+    {Kind.CLASS: True, Kind.STRUCT: True, Kind.ENUM: True, Kind.UNION: True}, False
+)
+"""Whether each :class:`Kind` is listed in the Class Hierarchy (namespaces aside)."""
+
+KIND_SORT_RANK = kindTable(
+    {
+        code: rank for rank, code in enumerate(
+            [Kind.STRUCT, Kind.CLASS] + sorted(
+                (c for c in Kind if c not in (Kind.STRUCT, Kind.CLASS, Kind.UNKNOWN)),
+                key=lambda c: c.name
+            )
+        )
+    },
+    len(Kind) - 1
+)
+'''
+The position of each :class:`Kind` when :class:`~exhale.graph.ExhaleNode` objects of
+different kinds are sorted: structs, then classes, then the rest alphabetically.
+'''
+
+KIND_ROOT_LISTS = kindTable(
+    {
+        Kind.CLASS:     "class_like",
+        Kind.DEFINE:    "defines",
+        Kind.DIR:       "dirs",
+        Kind.ENUM:      "enums",
+        Kind.ENUMVALUE: "enum_values",
+        Kind.FILE:      "files",
+        Kind.FUNCTION:  "functions",
+        Kind.GROUP:     "groups",
+        Kind.NAMESPACE: "namespaces",
+        Kind.STRUCT:    "class_like",
+        Kind.TYPEDEF:   "typedefs",
+        Kind.UNION:     "unions",
+        Kind.VARIABLE:  "variables",
+        Kind.PAGE:      "pages"
+    },
+    None
+)
+'''
+The :class:`~exhale.graph.ExhaleRoot` list each :class:`Kind` is tracked in, ``None``
+for :attr:`Kind.UNKNOWN`.
+'''
+
+KIND_DEFAULT_SPECIFICATIONS = kindTable(
+    {
+        Kind.CLASS:  (":members:", ":protected-members:", ":undoc-members:"),
+        Kind.STRUCT: (":members:", ":protected-members:", ":undoc-members:")
+    },
+    ()
+)
+"""The :func:`specificationsForKind` of each :class:`Kind` without a custom mapping."""
+
+
+def _configsOf(project_configs):
+    # The helpers used by graph.ExhaleRoot read the configuration of the project they are
+    # given (see configs.ProjectConfigs), or the variables of the configs module.
+    return configs if project_configs is None else project_configs
+
+
+def contentsDirectiveOrNone(kind, project_configs=None):
     '''
     Generates a string ``.. contents::`` directives according to the rules outlined in
     the :ref:`using_contents_directives` section.
@@ -166,17 +330,22 @@ def contentsDirectiveOrNone(kind):
         ``kind`` (str)
             The ``kind`` of the compound (one of :data:`~exhale.utils.AVAILABLE_KINDS`).
 
+        ``project_configs`` (:class:`~exhale.configs.ProjectConfigs` or ``None``)
+            The configuration of the project, ``None`` for the variables of
+            :mod:`exhale.configs`.
+
     **Return**
         ``str`` or ``None``
             If this ``kind`` should have a ``.. contents::`` directive, it returns the
             string that can be written to file.  Otherwise, ``None`` is returned.
     '''
-    if configs.contentsDirectives and kind in configs.kindsWithContentsDirectives:
+    project_configs = _configsOf(project_configs)
+    if project_configs.contentsDirectives and kind in project_configs.kindsWithContentsDirectives:
         ret = "\n.. contents:: {contentsTitle}".format(
-            contentsTitle=configs.contentsTitle
+            contentsTitle=project_configs.contentsTitle
         )
-        if configs.contentsSpecifiers:
-            specs = "\n".join(s for s in configs.contentsSpecifiers)
+        if project_configs.contentsSpecifiers:
+            specs = "\n".join(s for s in project_configs.contentsSpecifiers)
             ret   = "{directive}\n{specs}".format(
                 directive=ret,
                 specs=prefix("   ", specs)
@@ -248,19 +417,692 @@ def makeCustomSpecificationsMapping(func):
     return ret
 
 
-def nodeCompoundXMLContents(node):
-    node_xml_path = os.path.join(configs._doxygen_xml_output_directory, "{0}.xml".format(node.refid))
-    if os.path.isfile(node_xml_path):
+DOXYGEN_XML_ARCHIVE_SUFFIXES = (".zip", ".tar", ".tar.gz", ".tgz", ".tar.bz2", ".tar.xz", ".tar.zst")
+'''
+The file suffixes :data:`~exhale.configs._doxygen_xml_output_directory` may have to be
+read as a :class:`~exhale.utils.DoxygenXMLArchive` instead of a directory.
+'''
+
+
+def isDoxygenXMLArchive(path):
+    '''
+    Return whether ``path`` is a file ending in one of
+    :data:`~exhale.utils.DOXYGEN_XML_ARCHIVE_SUFFIXES`.
+    '''
+    return os.path.isfile(path) and path.lower().endswith(DOXYGEN_XML_ARCHIVE_SUFFIXES)
+
+
+def _removeOwnedFile(path, owner):
+    # Forked processes must not remove the files of their parent.
+    if os.getpid() == owner:
         try:
-            with codecs.open(node_xml_path, "r", "utf-8") as xml:
-                node_xml_contents = xml.read()
+            os.remove(path)
+        except OSError:
+            pass
+
+
+class DoxygenXMLArchive(object):
+    '''
+    Read Doxygen XML documents out of an archive without extracting it.
 
-            return node_xml_contents
+    The member names are indexed once, relative to the directory in the archive that
+    contains ``index.xml`` (so ``xml/index.xml`` and ``index.xml`` archives both work).
+    Only the index (names and offsets) is kept in memory, every document is read from
+    disk when it is needed.  ``.zip`` and uncompressed ``.tar`` archives are read with
+    random access in place.  Compressed tarballs cannot be, they are decompressed once
+    to a temporary uncompressed ``.tar`` (as large as the XML output) that is read with
+    random access, and removed by :func:`~exhale.utils.DoxygenXMLArchive.close`.
+    ``.tar.zst`` requires the ``compression.zstd`` (Python 3.14+) or ``zstandard``
+    module.
+
+    A process forked after the archive was indexed (e.g., a parallel read worker of
+    Sphinx) opens its own file handle, the index is shared.
+
+    **Parameters**
+        ``path`` (str)
+            The absolute path to the archive.
+    '''
+    def __init__(self, path):
+        self.path      = path
+        # The temporary uncompressed copy of a compressed tarball.
+        self.tar_path  = None
+        self._archive  = None
+        self._pid      = None
+        self._owner    = os.getpid()
+        # Values: ZipInfo (zip) or TarInfo (tar).
+        self._members  = {}
+
+        lower = path.lower()
+        if lower.endswith(".zip"):
+            names = {info.filename: info for info in self._open().infolist() if not info.is_dir()}
+        else:
+            if not lower.endswith(".tar"):
+                self.tar_path = self._decompress(path)
+                # Also removed when this is garbage collected, or the process exits.
+                weakref.finalize(self, _removeOwnedFile, self.tar_path, self._owner)
+            names = {info.name: info for info in self._open().getmembers() if info.isfile()}
+
+        index_names = sorted((n for n in names if posixpath.basename(n) == "index.xml"), key=len)
+        prefix = posixpath.dirname(index_names[0]) if index_names else ""
+        for name, member in names.items():
+            if prefix:
+                if not name.startswith(prefix + "/"):
+                    continue
+                name = name[len(prefix) + 1:]
+            self._members[name] = member
+
+    @staticmethod
+    def _decompress(path):
+        # Decompress the tarball to a temporary file in one sequential pass.
+        lower = path.lower()
+        if lower.endswith(".tar.zst"):
+            try:
+                from compression import zstd
+                stream = zstd.open(path, "rb")
+            except ImportError:
+                try:
+                    import zstandard
+                except ImportError:
+                    raise RuntimeError(
+                        "Reading [{0}] requires Python 3.14+ or the `zstandard` package.".format(path)
+                    )
+                stream = zstandard.ZstdDecompressor().stream_reader(open(path, "rb"), closefd=True)
+        elif lower.endswith(".tar.bz2"):
+            stream = bz2.open(path, "rb")
+        elif lower.endswith(".tar.xz"):
+            stream = lzma.open(path, "rb")
+        else:  # .tar.gz, .tgz
+            stream = gzip.open(path, "rb")
+
+        handle, tar_path = tempfile.mkstemp(prefix="exhale_xml_", suffix=".tar")
+        try:
+            with stream, os.fdopen(handle, "wb") as tar_file:
+                shutil.copyfileobj(stream, tar_file, 1 << 20)
+        except:
+            os.remove(tar_path)
+            raise
+        return tar_path
+
+    def _open(self):
+        # The archive opened by this process.
+        pid = os.getpid()
+        if self._pid != pid:
+            if self.path.lower().endswith(".zip"):
+                self._archive = zipfile.ZipFile(self.path)
+            else:
+                self._archive = tarfile.open(self.tar_path or self.path, "r:")
+            self._pid = pid
+        return self._archive
+
+    def close(self):
+        '''
+        Close the archive, and remove the uncompressed copy of a compressed tarball (only
+        in the process that created it).
+        '''
+        if self._archive is not None and self._pid == os.getpid():
+            self._archive.close()
+        self._archive = None
+        self._pid     = None
+        if self.tar_path is not None and self._owner == os.getpid():
+            _removeOwnedFile(self.tar_path, self._owner)
+            self.tar_path = None
+
+    def names(self):
+        '''
+        Return the sorted names of every document, relative to the ``index.xml`` directory.
+        '''
+        return sorted(self._members)
+
+    def __contains__(self, name):
+        return name in self._members
+
+    def read(self, name):
+        '''
+        Return the ``utf-8`` text of the document ``name`` (e.g. ``"index.xml"``), or
+        ``None`` if the archive does not contain it.
+        '''
+        member = self._members.get(name, None)
+        if member is None:
+            return None
+        archive = self._open()
+        if isinstance(archive, zipfile.ZipFile):
+            contents = archive.read(member)
+        else:
+            contents = archive.extractfile(member).read()
+        metrics.read(posixpath.basename(name), len(contents))
+        return contents.decode("utf-8")
+
+    def size(self, name):
+        '''
+        Return the size in bytes of the document ``name``, or ``0`` if the archive does
+        not contain it.
+        '''
+        member = self._members.get(name, None)
+        if member is None:
+            return 0
+        if isinstance(member, zipfile.ZipInfo):
+            return member.file_size
+        return member.size
+
+
+# Keys: path, see doxygenXMLArchive.
+_doxygen_xml_archives = {}
+
+
+def doxygenXMLArchive(project_configs=None):
+    '''
+    Return the :class:`~exhale.utils.DoxygenXMLArchive` for
+    :data:`~exhale.configs._doxygen_xml_output_directory`, or ``None`` when it is a
+    directory.  ``project_configs`` is the configuration of the project (``None`` for
+    the variables of :mod:`exhale.configs`).
+    '''
+    project_configs = _configsOf(project_configs)
+    path = project_configs._doxygen_xml_output_directory
+    if not path or not isDoxygenXMLArchive(path):
+        return None
+    if path not in _doxygen_xml_archives:
+        _doxygen_xml_archives[path] = DoxygenXMLArchive(path)
+    return _doxygen_xml_archives[path]
+
+
+# Keys: Doxygen XML output path, values: see doxygenXMLDocuments.
+_doxygen_xml_documents = {}
+
+
+def forgetDoxygenXML():
+    '''
+    Forget the documents found by :func:`~exhale.utils.doxygenXMLDocuments` and the
+    archives indexed by :func:`~exhale.utils.doxygenXMLArchive`, so that what Doxygen
+    (or anything else) wrote since is found.  Called by
+    :func:`~exhale.configs.prepare_doxygen_xml` every build, after running Doxygen.
+    '''
+    _doxygen_xml_documents.clear()
+    for archive in _doxygen_xml_archives.values():
+        archive.close()
+    _doxygen_xml_archives.clear()
+
+
+def doxygenXMLDocuments(project_configs=None):
+    '''
+    Map the file name of every ``.xml`` document in the Doxygen XML output to its path
+    relative to :data:`~exhale.configs._doxygen_xml_output_directory`.  The output is
+    scanned recursively once per build (see :func:`~exhale.utils.forgetDoxygenXML`), so
+    that documents Doxygen placed in sub-directories (``CREATE_SUBDIRS = YES``) are
+    found without searching for each one.  Breathe cannot read them, only the standalone
+    ``exhale`` command builds from such an output.
+
+    **Parameters**
+        ``project_configs`` (:class:`~exhale.configs.ProjectConfigs` or ``None``)
+            The configuration of the project, ``None`` for the variables of
+            :mod:`exhale.configs`.
+
+    **Return**
+        :class:`python:dict`
+            Keys are e.g. ``"classfoo.xml"``, values are e.g. ``"d4/d2/classfoo.xml"``
+            (``/`` separated).  A document found in several directories maps to the
+            least nested one.
+    '''
+    project_configs = _configsOf(project_configs)
+    root = project_configs._doxygen_xml_output_directory
+    documents = _doxygen_xml_documents.get(root, None)
+    if documents is None:
+        archive = doxygenXMLArchive(project_configs)
+        if archive is not None:
+            names = [n for n in archive.names() if n.endswith(".xml")]
+        else:
+            names = []
+            for dirpath, _, filenames in os.walk(root):
+                rel = os.path.relpath(dirpath, root).replace(os.sep, "/")
+                for f in filenames:
+                    if f.endswith(".xml"):
+                        names.append(f if rel == "." else "{0}/{1}".format(rel, f))
+
+        documents = {}
+        for name in sorted(names, key=lambda n: (n.count("/"), n)):
+            documents.setdefault(posixpath.basename(name), name)
+        _doxygen_xml_documents[root] = documents
+    return documents
+
+
+def hasDoxygenXML(name, project_configs=None):
+    '''
+    Return whether the document ``name`` (see :func:`~exhale.utils.readDoxygenXML`)
+    exists in the Doxygen XML output of ``project_configs`` (see
+    :func:`~exhale.utils.doxygenXMLArchive`).
+    '''
+    project_configs = _configsOf(project_configs)
+    archive = doxygenXMLArchive(project_configs)
+    if archive is not None:
+        return name in archive
+    return os.path.isfile(os.path.join(project_configs._doxygen_xml_output_directory, name))
+
+
+def readDoxygenXML(name, project_configs=None):
+    '''
+    Read a document of the Doxygen XML output, which may be an archive (see
+    :func:`~exhale.utils.doxygenXMLArchive`).
+
+    **Parameters**
+        ``name`` (str)
+            The ``/`` separated path relative to
+            :data:`~exhale.configs._doxygen_xml_output_directory`, e.g. ``"index.xml"``.
+
+        ``project_configs`` (:class:`~exhale.configs.ProjectConfigs` or ``None``)
+            The configuration of the project, ``None`` for the variables of
+            :mod:`exhale.configs`.
+
+    **Return**
+        ``str`` or ``None``
+            The contents, or ``None`` if the document does not exist or is unreadable.
+    '''
+    project_configs = _configsOf(project_configs)
+    archive = doxygenXMLArchive(project_configs)
+    if archive is not None:
+        return archive.read(name)
+
+    xml_path = os.path.join(project_configs._doxygen_xml_output_directory, *name.split("/"))
+    if os.path.isfile(xml_path):
+        try:
+            with codecs.open(xml_path, "r", "utf-8") as xml:
+                metrics.read(posixpath.basename(name), os.path.getsize(xml_path))
+                return xml.read()
         except:
             return None
     return None
 
 
+def doxygenXMLSize():
+    '''
+    The size of the Doxygen XML output, to compare how much of it was read against (see
+    :func:`~exhale.metrics.BuildMetrics.ioViolations`).
+
+    **Return**
+        int
+            The size in bytes of :data:`~exhale.configs.doxygenCombinedXML` when it is in
+            use, otherwise the total size of every document of
+            :func:`~exhale.utils.doxygenXMLDocuments`.
+    '''
+    if configs.doxygenCombinedXML:
+        return os.path.getsize(configs.doxygenCombinedXML)
+    archive = doxygenXMLArchive()
+    if archive is not None:
+        return sum(archive.size(name) for name in doxygenXMLDocuments().values())
+    root = configs._doxygen_xml_output_directory
+    return sum(
+        os.path.getsize(os.path.join(root, *name.split("/"))) for name in doxygenXMLDocuments().values()
+    )
+
+
+def nodeCompoundXMLContents(node, project_configs=None):
+    name = doxygenXMLDocuments(project_configs).get("{0}.xml".format(node.refid), None)
+    if name is None:
+        return None
+    return readDoxygenXML(name, project_configs)
+
+
+def iterCombinedCompounds(path, chunk_size=1 << 20):
+    '''
+    Read the output of Doxygen's ``combine.xslt`` sequentially, see
+    :data:`~exhale.configs.doxygenCombinedXML`.
+
+    **Parameters**
+        ``path`` (str)
+            The combined document.
+
+        ``chunk_size`` (int)
+            How many bytes to read at a time.
+
+    **Return**
+        generator of ``(int, bytes)``
+            The offset in bytes and the (UTF-8) contents of each
+            ``<compounddef>...</compounddef>`` element, in order.  See
+            :class:`~exhale.utils.CombinedCompounds` for reading one back later.
+    '''
+    start_tag = b"<compounddef"
+    end_tag   = b"</compounddef>"
+    buffered  = b""
+    offset    = 0  # where `buffered` starts in the file
+    resume    = 0  # where to continue searching `buffered` for end_tag
+    metrics.read(os.path.basename(path), os.path.getsize(path))
+    with open(path, "rb") as combined:
+        while True:
+            chunk = combined.read(chunk_size)
+            buffered += chunk
+            # Everything before `pos` was yielded (or is not part of an element), the
+            # buffer is only sliced once per chunk.
+            pos = 0
+            while True:
+                start = buffered.find(start_tag, pos)
+                if start < 0:
+                    # keep enough to find a start tag split between chunks
+                    pos = max(pos, len(buffered) - len(start_tag) + 1)
+                    resume = 0
+                    break
+                end = buffered.find(end_tag, max(start, resume))
+                if end < 0:
+                    pos = start
+                    resume = max(start, len(buffered) - len(end_tag) + 1)
+                    break
+                end += len(end_tag)
+                yield offset + start, buffered[start:end]
+                pos = end
+                resume = 0
+            if not chunk:
+                break
+            buffered = buffered[pos:]
+            offset += pos
+            resume = max(0, resume - pos)
+
+
+class CombinedCompounds(object):
+    '''
+    Read the ``<compounddef>`` elements of :data:`~exhale.configs.doxygenCombinedXML`
+    back by the offsets :func:`~exhale.utils.iterCombinedCompounds` reported, rather than
+    keeping their text.  The file is opened once per process (a forked parallel read
+    worker does not share the position of its parent).
+
+    **Parameters**
+        ``path`` (str)
+            The combined document.
+    '''
+    def __init__(self, path):
+        self.path  = path
+        self.spans = {}  # keys: refid, values: (offset, length)
+        self._file = None
+        self._pid  = None
+
+    def add(self, refid, offset, length):
+        '''Record where the ``<compounddef>`` of ``refid`` is.'''
+        self.spans[refid] = (offset, length)
+
+    def pop(self, refid, default=None):
+        '''Forget the ``<compounddef>`` of ``refid``, returning its span.'''
+        return self.spans.pop(refid, default)
+
+    def __contains__(self, refid):
+        return refid in self.spans
+
+    def __len__(self):
+        return len(self.spans)
+
+    def get(self, refid, default=None):
+        '''
+        **Return**
+            ``str`` or ``default``
+                The ``<compounddef>`` of ``refid`` as its own ``<doxygen>`` document
+                (exactly as the ``{refid}.xml`` would have been), or ``default``.
+        '''
+        span = self.spans.get(refid, None)
+        if span is None:
+            return default
+        if self._file is None or self._pid != os.getpid():
+            self._file = open(self.path, "rb")
+            self._pid  = os.getpid()
+        offset, length = span
+        self._file.seek(offset)
+        compounddef = self._file.read(length).decode("utf-8")
+        metrics.read("{0}.xml".format(refid), length)
+        return "<doxygen>\n  {0}\n</doxygen>\n".format(compounddef)
+
+    def close(self):
+        '''Close the file, :func:`get` opens it again if needed.'''
+        if self._file is not None and self._pid == os.getpid():
+            self._file.close()
+        self._file = None
+
+
+def sphinxDocname(path, project_configs=None):
+    '''
+    Return the Sphinx docname of a generated document.
+
+    **Parameters**
+        ``path`` (str)
+            The absolute path of a document below
+            :data:`~exhale.configs._app_src_dir`, e.g. ``node.file_name`` before
+            :func:`~exhale.graph.ExhaleRoot.gerrymanderNodeFilenames`.
+
+        ``project_configs`` (:class:`~exhale.configs.ProjectConfigs` or ``None``)
+            The configuration of the project, ``None`` for the variables of
+            :mod:`exhale.configs`.
+
+    **Return**
+        ``str``
+            The path relative to the source directory with ``/`` separators, and the
+            ``.rst`` suffix removed.
+    '''
+    project_configs = _configsOf(project_configs)
+    # Undo the \\?\ prefix for long paths on Windows, see MAXIMUM_WINDOWS_PATH_LENGTH.
+    magic = "{slash}{slash}?{slash}".format(slash="\\")
+    if path.startswith(magic):
+        path = path[len(magic):]
+    rel = os.path.relpath(path, project_configs._app_src_dir)
+    return os.path.splitext(rel)[0].replace(os.sep, "/")
+
+
+def writeIfChanged(path, contents):
+    '''
+    Write ``contents`` to ``path`` only when the file does not exist or differs, so that
+    the modification time of unchanged documents is preserved.
+
+    **Parameters**
+        ``path`` (str)
+            The file to write.
+
+        ``contents`` (str)
+            The ``utf-8`` text that ``path`` should contain.
+
+    **Return**
+        ``bool``
+            ``True`` if the file was written.
+    '''
+    if os.path.isfile(path):
+        try:
+            with codecs.open(path, "r", "utf-8") as existing:
+                if existing.read() == contents:
+                    return False
+        except:
+            pass
+    detachSharedFile(path)
+    with codecs.open(path, "w", "utf-8") as gen_file:
+        gen_file.write(contents)
+    return True
+
+
+def detachSharedFile(path, keep_contents=False):
+    '''
+    Make sure writing to ``path`` does not write to other hard links of the same file,
+    such as the objects of :data:`~exhale.configs.contentStoreDirectory`.  Files with
+    only one link are left alone.
+
+    **Parameters**
+        ``path`` (str)
+            The file about to be written.
+
+        ``keep_contents`` (bool)
+            ``True`` when appending, so the detached file keeps the current contents.
+    '''
+    try:
+        if os.stat(path).st_nlink < 2:
+            return
+    except OSError:
+        return  # does not exist yet
+
+    contents = None
+    if keep_contents:
+        with open(path, "rb") as shared:
+            contents = shared.read()
+    os.remove(path)
+    if contents is not None:
+        with open(path, "wb") as detached:
+            detached.write(contents)
+
+
+def storeDocument(path, store, previous=None):
+    '''
+    Add the document ``path`` to the content addressed ``store`` and replace it with a
+    hard link to (or copy of) the stored object.  See
+    :data:`~exhale.configs.contentStoreDirectory`.
+
+    Every document is linked the first time it is written, whether or not a previous
+    build recorded it.  Sphinx only re-reads documents modified after its environment
+    was written, so ``previous`` only decides the modification time: a document with
+    the same contents as the previous build keeps the time of the stored object, any
+    other document (including contents stored long ago, e.g., after a revert or by
+    another release branch) is given the current time.  Since the object is shared,
+    other builds linked to it re-read the same contents once.
+
+    **Parameters**
+        ``path`` (str)
+            The generated document.
+
+        ``store`` (str)
+            The absolute path to the content store directory.
+
+        ``previous`` (str or ``None``)
+            The digest of ``path`` recorded by the previous build, ``None`` when it was
+            not generated before (or there is no previous manifest).
+
+    **Return**
+        ``str``
+            The ``sha256`` hex digest of the contents of ``path``.
+    '''
+    with open(path, "rb") as document:
+        contents = document.read()
+    digest = hashlib.sha256(contents).hexdigest()
+    stored = os.path.join(store, "objects", digest[:2], digest[2:])
+
+    if not os.path.isfile(stored):
+        os.makedirs(os.path.dirname(stored), exist_ok=True)
+        # Several builds may share the store, make the object appear atomically.  The
+        # document itself becomes the object where possible.
+        staging = "{0}.{1}.tmp".format(stored, os.getpid())
+        try:
+            os.link(path, staging)
+        except OSError:
+            with open(staging, "wb") as staged:
+                staged.write(contents)
+        os.replace(staging, stored)
+
+    if not os.path.samefile(path, stored):
+        staging = "{0}.exhale.tmp".format(path)
+        try:
+            os.link(stored, staging)
+        except OSError:
+            # e.g., the store is on a different file system
+            shutil.copy2(stored, staging)
+        os.replace(staging, path)
+
+    if digest != previous:
+        # Only the time changes, the contents of the stored object are never touched.
+        os.utime(path)
+    return digest
+
+
+def doxygenExcludeSymbol(regex):
+    """
+    Translate a compiled :data:`~exhale.configs.listingExclude` regular expression to a
+    Doxygen ``EXCLUDE_SYMBOLS`` pattern.
+
+    Doxygen only understands the ``*`` wildcard and the ``^`` / ``$`` anchors, so only
+    patterns made of identifier characters, ``::``, and ``.*`` can be translated.  Since
+    :func:`python:re.match` is used for ``listingExclude``, the translation is always
+    anchored at the start, and ends with ``*`` unless the pattern ended with ``$``.
+
+    **Parameters**
+        ``regex`` (:class:`python:re.Pattern`)
+            The compiled ``listingExclude`` item.
+
+    **Return**
+        :class:`python:str` or ``None``
+            The Doxygen pattern, or ``None`` when ``regex`` cannot be expressed as one
+            (e.g., it has flags such as :data:`python:re.IGNORECASE`).
+    """
+    if regex.flags & ~re.UNICODE:
+        return None
+    pattern = regex.pattern
+    if pattern.startswith("^"):
+        pattern = pattern[1:]
+    anchored_end = pattern.endswith("$") and not pattern.endswith("\\$")
+    if anchored_end:
+        pattern = pattern[:-1]
+
+    symbol = StringIO()
+    idx = 0
+    while idx < len(pattern):
+        if pattern.startswith(".*", idx):
+            symbol.write("*")
+            idx += 2
+        elif pattern[idx].isalnum() or pattern[idx] in "_:~":
+            symbol.write(pattern[idx])
+            idx += 1
+        else:
+            return None
+
+    symbol = symbol.getvalue()
+    if not symbol or symbol == "*":
+        return None
+    if not symbol.startswith("*"):
+        symbol = "^" + symbol
+    if anchored_end:
+        return symbol + "$"
+    return symbol if symbol.endswith("*") else symbol + "*"
+
+
+def parentScope(name):
+    """
+    The scope ``name`` is declared in, without splitting and joining every component.
+
+    **Parameters**
+        ``name`` (:class:`python:str`)
+            The fully qualified name, e.g., ``namespace::ClassName::NestedEnum``.
+
+    **Return**
+        :class:`python:str` or ``None``
+            Everything before the last ``::`` (``namespace::ClassName``), ``None`` if
+            ``name`` has no ``::``.
+    """
+    scope, sep, _ = name.rpartition("::")
+    return scope if sep else None
+
+
+def listingExcluded(name, project_configs=None):
+    """
+    Whether ``name`` (or a scope it is nested in) matches any item of
+    :data:`~exhale.configs.listingExclude`.
+
+    **Parameters**
+        ``name`` (:class:`python:str`)
+            The fully qualified name, e.g., ``namespace::ClassName::NestedEnum``.
+
+        ``project_configs`` (:class:`~exhale.configs.ProjectConfigs` or ``None``)
+            The configuration of the project, ``None`` for the variables of
+            :mod:`exhale.configs`.
+
+    **Return**
+        :class:`python:bool`
+            ``True`` if ``name``, ``namespace::ClassName``, or ``namespace`` matched.
+    """
+    project_configs = _configsOf(project_configs)
+    # The enclosing scopes end at every `::` outside of template arguments.
+    scope_ends = []
+    depth = 0
+    for idx, char in enumerate(name):
+        if char == "<":
+            depth += 1
+        elif char == ">":
+            depth -= 1
+        elif depth == 0 and name.startswith("::", idx) and idx > 0 and name[idx - 1] != ":":
+            scope_ends.append(idx)
+    scope_ends.append(len(name))
+
+    for end in scope_ends:
+        scope = name[:end]
+        for exclude in project_configs._compiled_listing_exclude:
+            if exclude.match(scope):
+                return True
+    return False
+
+
 def sanitize(name):
     """
     Sanitize the specified ``name`` for use with breathe directives.
@@ -295,6 +1137,37 @@ def sanitize(name):
     )
 
 
+def templateDeclaration(memberdef):
+    '''
+    Reconstruct the ``template <...>`` prefix of a Doxygen ``<memberdef>``.
+
+    **Parameters**
+        ``memberdef`` (:class:`bs4.element.Tag`)
+            The ``<memberdef>`` of a function, variable, or typedef.
+
+    **Return**
+        :class:`python:str`
+            For example ``"template <typename T, int N = 2> "`` (note the trailing space),
+            or the empty string if ``memberdef`` is not a template.
+    '''
+    templateparamlist = memberdef.find("templateparamlist", recursive=False)
+    if not templateparamlist:
+        return ""
+
+    params = []
+    for param in templateparamlist.find_all("param", recursive=False):
+        # Older Doxygen puts e.g. "typename T" in <type>, newer splits out <declname>.
+        parts = [" ".join(param.type.get_text().split()) if param.type else ""]
+        declname = param.find("declname", recursive=False)
+        if declname and parts[0].split()[-1:] != [declname.get_text().strip()]:
+            parts.append(declname.get_text().strip())
+        defval = param.find("defval", recursive=False)
+        if defval:
+            parts.append("= {0}".format(" ".join(defval.get_text().split())))
+        params.append(" ".join(p for p in parts if p))
+    return "template <{0}> ".format(", ".join(params))
+
+
 def sanitize_all(names):
     """
     Convenience function to :func:`~exhale.utils.sanitize` all provided names.
@@ -358,7 +1231,7 @@ We need to take each one of those, and map them to their corresponding
 '''
 
 
-def doxygenLanguageToPygmentsLexer(location, language):
+def doxygenLanguageToPygmentsLexer(location, language, project_configs=None):
     '''
     Given an input location and language specification, acquire the Pygments lexer to
     use for this file.
@@ -370,11 +1243,15 @@ def doxygenLanguageToPygmentsLexer(location, language):
        :data:`LANG_TO_LEX <exhale.utils.LANG_TO_LEX>` is used.
     3. If no matching language is found, ``"none"`` is returned (indicating to Pygments
        that no syntax highlighting should occur).
+
+    ``project_configs`` is the configuration of the project (``None`` for the variables
+    of :mod:`exhale.configs`).
     '''
-    if configs._compiled_lexer_mapping:
-        for regex in configs._compiled_lexer_mapping:
+    project_configs = _configsOf(project_configs)
+    if project_configs._compiled_lexer_mapping:
+        for regex in project_configs._compiled_lexer_mapping:
             if regex.match(location):
-                return configs._compiled_lexer_mapping[regex]
+                return project_configs._compiled_lexer_mapping[regex]
 
     if language in LANG_TO_LEX:
         return LANG_TO_LEX[language]
@@ -446,10 +1323,10 @@ def qualifyKind(kind):
         other qualifying names.  If the empty string is returned then it was not
         recognized.
     '''
-    if kind == "dir":
-        return "Directory"
-    else:
+    code = kindCode(kind)
+    if code == Kind.UNKNOWN:
         return kind.capitalize()
+    return KIND_QUALIFIERS[code]
 
 
 def kindAsBreatheDirective(kind):
@@ -504,10 +1381,13 @@ def kindAsBreatheDirective(kind):
         The directive to be used for the given ``kind``.  The empty string is returned
         for both unrecognized and ignored input values.
     '''
-    return "doxygen{kind}".format(kind=kind)
+    code = kindCode(kind)
+    if code == Kind.UNKNOWN:
+        return "doxygen{kind}".format(kind=kind)
+    return KIND_DIRECTIVES[code]
 
 
-def specificationsForKind(kind):
+def specificationsForKind(kind, project_configs=None):
     '''
     .. todo:: update docs for new list version rather than string returns
     '''
@@ -555,26 +1435,30 @@ def specificationsForKind(kind):
         ``kind`` (str)
             The kind of the node we are generating the directive specifications for.
 
+        ``project_configs`` (:class:`~exhale.configs.ProjectConfigs` or ``None``)
+            The configuration of the project, ``None`` for the variables of
+            :mod:`exhale.configs`.
+
     :Return (str):
         The correctly formatted specifier(s) for the given ``kind``.  If no specifier(s)
         are necessary or desired, the empty string is returned.
     '''
+    project_configs = _configsOf(project_configs)
     # TODO: this is to support the monkeypatch
     # https://github.com/svenevs/exhale/issues/27
     ret = []
 
     # use the custom directives function
-    if configs.customSpecificationsMapping:
-        ret = configs.customSpecificationsMapping[kind]
+    if project_configs.customSpecificationsMapping:
+        ret = project_configs.customSpecificationsMapping[kind]
     # otherwise, just provide class and struct
-    elif kind == "class" or kind == "struct":
-        ret = [":members:", ":protected-members:", ":undoc-members:"]
+    else:
+        ret = KIND_DEFAULT_SPECIFICATIONS[kindCode(kind)]
 
-    # the monkeypatch re-configures breathe_default_project each time which was
-    # foolishly relied on elsewhere and undoing that blunder requires undoing
-    # all of the shenanigans that is configs.py...
+    # The project being documented, which is not breathe_default_project for the
+    # other exhale_projects (see configs.ProjectConfigs).
     if not any(":project:" in spec for spec in ret):
-        ret.insert(0, ":project: " + configs._the_app.config.breathe_default_project)
+        ret = [":project: " + project_configs._breathe_project] + list(ret)
     return ret
 
 
@@ -786,13 +1670,81 @@ def critical(msg, ansi_fmt=AnsiColors.BOLD_RED, output_stream=sys.stderr):
     return _use_color(prefix("(!) ", msg), ansi_fmt, output_stream)
 
 
-def verbose_log(msg, ansi_fmt=None):
-    if configs.verboseBuild:
-        if ansi_fmt:
-            log = _use_color(msg, ansi_fmt, sys.stderr)
-        else:
-            log = msg
-        sys.stderr.write("{log}\n".format(log=log))
+# The open configs.verboseBuildFile (and its path), and every path opened during this
+# build (later projects writing to the same file append to it), see resetVerboseLog.
+_verbose_file = None
+_verbose_path = None
+_verbose_paths_opened = set()
+_ANSI_ESCAPE = re.compile(r"\033\[[0-9;]*m")
+
+
+def verbose_log(msg, ansi_fmt=None, *args):
+    '''
+    Log ``msg`` when :data:`~exhale.configs.verboseBuild` is ``True``, to
+    :data:`~exhale.configs.verboseBuildFile` when it is set and otherwise at the ``INFO``
+    level of the Sphinx logger.  Nothing else happens when the build is not verbose, so
+    pass what the message is formatted with as ``args`` rather than formatting it first.
+    Loops over every node should check :data:`~exhale.configs.verboseBuild` before
+    calling this at all.
+
+    .. code-block:: py
+
+       utils.verbose_log("    - [{0}]", utils.AnsiColors.BOLD_MAGENTA, node.name)
+
+    **Parameters**
+        ``msg`` (str)
+            The message, formatted with ``args`` (``msg.format(*args)``) if any are given.
+
+        ``ansi_fmt`` (str or ``None``)
+            The color of the message on the console (never in the file), see
+            :class:`~exhale.utils.AnsiColors`.
+
+        ``args``
+            The values to format ``msg`` with.
+    '''
+    global _verbose_file, _verbose_path
+    if not configs.verboseBuild:
+        return
+    if args:
+        msg = msg.format(*args)
+    path = configs.verboseBuildFile
+    if path:
+        if path != _verbose_path:
+            closeVerboseLog()
+            directory = os.path.dirname(path)
+            if directory and not os.path.isdir(directory):
+                os.makedirs(directory)
+            _verbose_file = codecs.open(path, "a" if path in _verbose_paths_opened else "w", "utf-8")
+            _verbose_path = path
+            _verbose_paths_opened.add(path)
+        _verbose_file.write(_ANSI_ESCAPE.sub("", msg))
+        _verbose_file.write("\n")
+    else:
+        logger.info(_use_color(msg, ansi_fmt, sys.stdout) if ansi_fmt else msg)
+
+
+def closeVerboseLog():
+    '''
+    Close :data:`~exhale.configs.verboseBuildFile` if :func:`~exhale.utils.verbose_log`
+    opened it, called at the end of :func:`~exhale.deploy.explode`.
+    '''
+    global _verbose_file, _verbose_path
+    if _verbose_file is not None:
+        _verbose_file.close()
+    _verbose_file = None
+    _verbose_path = None
+
+
+def resetVerboseLog():
+    '''
+    Close :data:`~exhale.configs.verboseBuildFile` and forget every path written this
+    build, so that the next :func:`~exhale.utils.verbose_log` replaces the file rather
+    than appending to it.  Called when a build starts, by
+    :func:`~exhale.configs.apply_sphinx_configurations` and
+    :func:`~exhale.deploy.explodeProjects`.
+    '''
+    closeVerboseLog()
+    _verbose_paths_opened.clear()
 
 
 def __fancy(text, language, fmt):
@@ -0,0 +1,306 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+"""
+Benchmark :func:`~exhale.graph.ExhaleRoot.parse` and
+:func:`~exhale.graph.ExhaleRoot.generateFullAPI` and catch regressions.
+
+Every case is generated (without Sphinx, see :mod:`exhale.cli`) ``--repeat`` times, the
+fastest time of each phase (as recorded by :mod:`exhale.metrics`) is its result.  The
+cases are the projects in ``testing/projects`` (Doxygen runs once per project, it is not
+timed) and the synthetic projects of :data:`SYNTHETIC_CASES` (see
+:mod:`testing.synthetic`).  Save a baseline on a known good commit, then compare::
+
+    $ python -m testing.benchmark --save
+    $ git checkout my-branch
+    $ python -m testing.benchmark --threshold 0.15
+    case                     phase                  baseline   measured    change
+    cpp_nesting              parse                   0.0212s    0.0208s     -1.9%
+    ...
+    synthetic_medium         generateFullAPI         4.1130s    5.0022s    +21.6%  REGRESSED
+
+The command exits with ``1`` when any phase is slower than its baseline by more than
+``--threshold`` (a fraction) and ``--min-seconds``, the latter keeps the noise of the
+tiny projects from failing.  Baselines are machine specific, by default they are
+stored in ``testing/.benchmarks`` (next to the ``pytest`` cache).
+"""
+
+from __future__ import unicode_literals
+
+import argparse
+import codecs
+import contextlib
+import io
+import json
+import os
+import platform
+import shutil
+import sys
+
+from testing.synthetic import SyntheticProject
+
+__all__ = [
+    "PHASES", "SYNTHETIC_CASES", "DEFAULT_BASELINE", "testingProjects", "benchmarkXML",
+    "benchmarkProject", "benchmarkSynthetic", "compareToBaseline", "main"
+]
+
+
+PHASES = ("parse", "generateFullAPI")
+""" The phases of :class:`~exhale.metrics.BuildMetrics` that are benchmarked. """
+
+SYNTHETIC_CASES = {
+    "synthetic_small": dict(namespace_depth=2, namespace_fanout=4, classes_per_namespace=4),
+    "synthetic_medium": dict(namespace_depth=3, namespace_fanout=6, classes_per_namespace=6,
+                             template_specializations=2),
+    "synthetic_large": dict(namespace_depth=4, namespace_fanout=6, classes_per_namespace=8,
+                            functions_per_namespace=4, template_specializations=2)
+}
+"""
+The :class:`~testing.synthetic.SyntheticProject` parameters of every synthetic case.
+Roughly 300, 5000, and 40000 nodes, ``synthetic_large`` only runs when asked for.
+"""
+
+DEFAULT_BASELINE = os.path.join(os.path.dirname(os.path.abspath(__file__)), ".benchmarks", "baseline.json")
+""" Where baselines are saved and compared to unless ``--baseline`` is given. """
+
+_PROJECTS_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "projects")
+
+
+def testingProjects():
+    """
+    **Return**
+        :class:`python:list` of str
+            The name of every project in ``testing/projects``.
+    """
+    return sorted(
+        name for name in os.listdir(_PROJECTS_DIR)
+        if os.path.isdir(os.path.join(_PROJECTS_DIR, name, "include"))
+    )
+
+
+def _explode(name, confdir, exhale_args, xml_dir):
+    # Generate once without Sphinx, returning the metrics of the root.
+    from exhale import cli, configs, deploy
+
+    configs._default_configs.activate()
+    app = cli.StandaloneApplication(confdir, confdir, {
+        "exhale_args": exhale_args,
+        "breathe_projects": {name: xml_dir},
+        "breathe_default_project": name
+    })
+    # The progress messages of every repetition are not interesting.
+    with contextlib.redirect_stdout(io.StringIO()):
+        configs.apply_sphinx_configurations(app)
+        deploy.explode()
+    return app.exhale_root.metrics
+
+
+def benchmarkXML(name, workdir, repeat, exhale_args, xml_dir, run_doxygen=False, phases=PHASES):
+    """
+    Generate the API of ``xml_dir`` ``repeat`` times.
+
+    **Parameters**
+        ``name`` (str)
+            The project (``breathe_default_project``).
+
+        ``workdir`` (str)
+            The directory to generate in (the ``conf.py`` directory), created if needed.
+
+        ``repeat`` (int)
+            How many times to generate.
+
+        ``exhale_args`` (:class:`python:dict`)
+            The configuration, ``containmentFolder`` and ``rootFileName`` are added.
+
+        ``xml_dir`` (str)
+            The Doxygen XML directory.
+
+        ``run_doxygen`` (bool)
+            Whether to run Doxygen (with the ``exhaleDoxygenStdin`` of ``exhale_args``),
+            it only runs the first time.
+
+        ``phases`` (:class:`python:tuple` of str or ``None``)
+            The phases to time, every phase (but those of Doxygen) when ``None``.
+
+    **Return**
+        :class:`python:dict`
+            The fastest seconds of every phase in ``phases``.
+    """
+    if not os.path.isdir(workdir):
+        os.makedirs(workdir)
+    exhale_args = dict(exhale_args, containmentFolder="./api", rootFileName="{0}_root.rst".format(name))
+    best = {}
+    for iteration in range(repeat):
+        shutil.rmtree(os.path.join(workdir, "api"), ignore_errors=True)
+        args = dict(exhale_args, exhaleExecutesDoxygen=run_doxygen and iteration == 0)
+        if not args["exhaleExecutesDoxygen"]:
+            args.pop("exhaleDoxygenStdin", None)  # not warned about being ignored
+        metrics = _explode(name, workdir, args, xml_dir)
+        if phases is None:
+            phases = tuple(sorted(set(
+                p["name"] for p in metrics.phases if not p["name"].startswith("doxygen")
+            )))
+        for phase in phases:
+            seconds = metrics.seconds(phase)
+            best[phase] = min(best.get(phase, seconds), seconds)
+    return best
+
+
+def benchmarkProject(project, workdir, repeat):
+    """
+    Benchmark ``testing/projects/{project}``, see :func:`benchmarkXML`.  Doxygen runs
+    (in ``workdir``) before the first repetition.
+    """
+    project_dir = os.path.join(_PROJECTS_DIR, project)
+    return benchmarkXML(project, workdir, repeat, {
+        "doxygenStripFromPath": project_dir,
+        "exhaleDoxygenStdin": 'INPUT = "{0}"'.format(os.path.join(project_dir, "include"))
+    }, "./_doxygen/xml", run_doxygen=True)
+
+
+def benchmarkSynthetic(name, synthetic_project, workdir, repeat, phases=PHASES):
+    """
+    Benchmark the XML of ``synthetic_project`` (a :class:`~testing.synthetic.SyntheticProject`),
+    written to ``workdir``, see :func:`benchmarkXML`.
+    """
+    xml_dir = os.path.join(workdir, "xml")
+    shutil.rmtree(xml_dir, ignore_errors=True)
+    synthetic_project.write(xml_dir)
+    return benchmarkXML(name, workdir, repeat, {"doxygenStripFromPath": "."}, xml_dir, phases=phases)
+
+
+def compareToBaseline(results, baseline, threshold, min_seconds):
+    """
+    Find the phases that regressed.
+
+    **Parameters**
+        ``results`` (:class:`python:dict`)
+            The seconds of every phase keyed by case, e.g.
+            ``{"cpp_nesting": {"parse": 0.02, "generateFullAPI": 0.05}}``.
+
+        ``baseline`` (:class:`python:dict`)
+            The ``"cases"`` of a saved baseline, in the same form.  Cases and phases that
+            are not in it are not compared.
+
+        ``threshold`` (float)
+            How much slower (as a fraction of the baseline) a phase may be.
+
+        ``min_seconds`` (float)
+            How much slower (in seconds) a phase must also be to regress.
+
+    **Return**
+        :class:`python:list` of ``(case, phase, baseline, measured)``
+            Every phase that regressed, in order.
+    """
+    regressions = []
+    for case in sorted(results):
+        for phase in PHASES:
+            measured = results[case].get(phase, None)
+            expected = baseline.get(case, {}).get(phase, None)
+            if measured is None or expected is None:
+                continue
+            if measured > expected * (1.0 + threshold) and measured - expected > min_seconds:
+                regressions.append((case, phase, expected, measured))
+    return regressions
+
+
+def main(argv=None):
+    """
+    Entry point for ``python -m testing.benchmark``, run with ``--help`` for the
+    options.
+
+    **Parameters**
+        ``argv`` (:class:`python:list` of str or ``None``)
+            The command line arguments, ``sys.argv[1:]`` when ``None``.
+
+    **Return**
+        int
+            ``1`` when a phase regressed, otherwise ``0``.
+    """
+    default_cases = testingProjects() + ["synthetic_small", "synthetic_medium"]
+    parser = argparse.ArgumentParser(
+        prog="python -m testing.benchmark",
+        description="Time parsing and generating, and compare to a saved baseline."
+    )
+    parser.add_argument(
+        "cases", nargs="*", default=default_cases,
+        help="The cases to run: {0}, or synthetic_large (default: all but synthetic_large).".format(
+            ", ".join(default_cases)
+        )
+    )
+    parser.add_argument("-r", "--repeat", type=int, default=3, help="default: %(default)s")
+    parser.add_argument("-b", "--baseline", default=DEFAULT_BASELINE, help="default: %(default)s")
+    parser.add_argument("-s", "--save", action="store_true", help="Save the results as the baseline.")
+    parser.add_argument(
+        "-t", "--threshold", type=float, default=0.2,
+        help="The fraction a phase may be slower than its baseline (default: %(default)s)."
+    )
+    parser.add_argument(
+        "--min-seconds", type=float, default=0.01,
+        help="How many seconds slower a phase must also be to regress (default: %(default)s)."
+    )
+    parser.add_argument(
+        "-w", "--workdir", default=os.path.join(os.path.dirname(DEFAULT_BASELINE), "work"),
+        help="Where to generate (default: %(default)s)."
+    )
+    args = parser.parse_args(argv)
+
+    results = {}
+    for case in args.cases:
+        workdir = os.path.join(os.path.abspath(args.workdir), case.replace(" ", "_"))
+        if case in SYNTHETIC_CASES:
+            project = SyntheticProject(**SYNTHETIC_CASES[case])
+            results[case] = benchmarkSynthetic(case, project, workdir, args.repeat)
+        elif case in testingProjects():
+            results[case] = benchmarkProject(case, workdir, args.repeat)
+        else:
+            parser.error("Unknown case '{0}'.".format(case))
+        shutil.rmtree(workdir, ignore_errors=True)
+
+    if args.save:
+        directory = os.path.dirname(os.path.abspath(args.baseline))
+        if not os.path.isdir(directory):
+            os.makedirs(directory)
+        with codecs.open(args.baseline, "w", "utf-8") as baseline_file:
+            json.dump({"python": platform.python_version(), "cases": results}, baseline_file, indent=2)
+            baseline_file.write("\n")
+        for case in sorted(results):
+            for phase in PHASES:
+                sys.stdout.write("{0:<24} {1:<20} {2:>9.4f}s\n".format(case, phase, results[case][phase]))
+        sys.stdout.write("Saved the baseline [{0}].\n".format(args.baseline))
+        return 0
+
+    baseline = {}
+    if os.path.isfile(args.baseline):
+        with codecs.open(args.baseline, "r", "utf-8") as baseline_file:
+            baseline = json.load(baseline_file)["cases"]
+    else:
+        sys.stdout.write("No baseline [{0}], save one with --save.\n".format(args.baseline))
+
+    regressed = set((case, phase) for case, phase, _, _ in compareToBaseline(
+        results, baseline, args.threshold, args.min_seconds
+    ))
+    sys.stdout.write("{0:<24} {1:<20} {2:>9} {3:>10} {4:>9}\n".format(
+        "case", "phase", "baseline", "measured", "change"
+    ))
+    for case in sorted(results):
+        for phase in PHASES:
+            measured = results[case][phase]
+            expected = baseline.get(case, {}).get(phase, None)
+            if expected is None:
+                before, change = "-", ""
+            else:
+                before = "{0:.4f}s".format(expected)
+                change = "{0:+.1%}".format(measured / expected - 1.0) if expected else ""
+            sys.stdout.write("{0:<24} {1:<20} {2:>9} {3:>9.4f}s {4:>9}{5}\n".format(
+                case, phase, before, measured, change, "  REGRESSED" if (case, phase) in regressed else ""
+            ))
+    return 1 if regressed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,237 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+"""
+Measure how every stage of parsing and generating scales, to catch accidental
+quadratic behavior before it hits a project of production size.
+
+Every stage is a phase recorded by :mod:`exhale.metrics` (e.g. ``discoverAllNodes`` or
+``generateFileNodeDocuments``).  A synthetic project (see :mod:`testing.synthetic`) is
+generated at several sizes, and the growth exponent of every stage is fit to its times:
+the slope of ``log(seconds / log(n))`` over ``log(n)``, where ``n`` is the number of
+nodes.  A stage growing like ``n log n`` has an exponent of ``1``, a stage with an
+exponent above ``1 + tolerance`` fails::
+
+    $ python -m testing.complexity
+    scaling      stage                              exponent   largest
+    members      discoverAllNodes                       1.04   0.3121s
+    ...
+    namespaces   filePostProcess                        1.93   0.0880s  FAILED
+
+The projects grow in two ways (see :data:`SCALINGS`), more namespaces (and their files
+and directories), and more members in every namespace, file, and directory, so both a
+scan of every node and a scan of the children of one are caught.  Stages that take less
+than ``--min-seconds`` at the largest size are reported but never fail, their times are
+mostly noise.  With ``pytest``, pass ``--complexity`` to run
+:func:`~testing.tests.complexity.test_complexity`.
+"""
+
+from __future__ import unicode_literals
+
+import argparse
+import math
+import os
+import shutil
+import sys
+
+from testing.benchmark import benchmarkSynthetic
+from testing.synthetic import SyntheticProject
+
+__all__ = ["SCALINGS", "SIZES", "MIN_SECONDS", "fitExponent", "measureScaling", "checkScaling", "main"]
+
+
+def _namespaces(size):
+    # A directory and a header per namespace, scans of every node / file / directory.
+    return SyntheticProject(
+        namespace_depth=1, namespace_fanout=32 * size, classes_per_namespace=2,
+        functions_per_namespace=1, overloads_per_function=1, files_per_directory=1
+    )
+
+
+def _members(size):
+    # One namespace and directory with many files, classes, and functions in it.
+    return SyntheticProject(
+        namespace_depth=1, namespace_fanout=1, classes_per_namespace=64 * size,
+        functions_per_namespace=16 * size, files_per_directory=8 * size
+    )
+
+
+SCALINGS = {"namespaces": _namespaces, "members": _members}
+"""
+The synthetic project of every way a project can grow, keyed by name.  Values are
+callables taking the size (an :data:`SIZES` entry), returning a
+:class:`~testing.synthetic.SyntheticProject`.
+"""
+
+SIZES = (4, 8, 16, 32)
+"""
+The default sizes every scaling is measured at, from roughly 550 to 7200 nodes.  At
+smaller sizes every stage finishes below :data:`MIN_SECONDS`, and nothing can fail.
+"""
+
+MIN_SECONDS = 0.05
+"""
+Stages faster than this at the largest size are reported but never fail, below it the
+times are mostly timer and scheduling noise.
+"""
+
+
+def fitExponent(sizes, seconds, log_factor=True):
+    """
+    Fit the growth exponent ``k`` of ``seconds ~ sizes ** k`` by least squares.
+
+    **Parameters**
+        ``sizes`` (:class:`python:list` of int)
+            The input sizes (at least two different ones).
+
+        ``seconds`` (:class:`python:list` of float)
+            The time of every size.
+
+        ``log_factor`` (bool)
+            Whether to divide out a factor of ``log(size)`` first, so ``n log n`` growth
+            has an exponent of ``1``.
+
+    **Return**
+        float
+            The exponent ``k``.
+    """
+    xs = [math.log(n) for n in sizes]
+    ys = [math.log(max(t, 1e-9) / (math.log(n) if log_factor else 1.0)) for n, t in zip(sizes, seconds)]
+    x_mean = sum(xs) / len(xs)
+    y_mean = sum(ys) / len(ys)
+    spread = sum((x - x_mean) ** 2 for x in xs)
+    if spread == 0:
+        raise ValueError("At least two different sizes are needed to fit an exponent.")
+    return sum((x - x_mean) * (y - y_mean) for x, y in zip(xs, ys)) / spread
+
+
+def measureScaling(scaling, sizes, workdir, repeat):
+    """
+    Time every stage of the ``scaling`` synthetic project at every size.
+
+    **Parameters**
+        ``scaling`` (str)
+            The key in :data:`SCALINGS`.
+
+        ``sizes`` (:class:`python:list` of int)
+            The sizes to generate.
+
+        ``workdir`` (str)
+            Where to generate, removed afterward.
+
+        ``repeat`` (int)
+            How many times to generate every size, the fastest time counts.
+
+    **Return**
+        ``(nodes, stages)``
+            The number of nodes of every size (a :class:`python:list`), and the seconds of
+            every stage at every size (a :class:`python:dict` of lists keyed by stage).
+    """
+    nodes = []
+    stages = {}
+    try:
+        for size in sizes:
+            project = SCALINGS[scaling](size)
+            nodes.append(sum(project.counts().values()))
+            seconds = benchmarkSynthetic(scaling, project, workdir, repeat, phases=None)
+            for stage, t in seconds.items():
+                stages.setdefault(stage, []).append(t)
+    finally:
+        shutil.rmtree(workdir, ignore_errors=True)
+    # Stages that did not run at every size cannot be fit.
+    return nodes, {stage: t for stage, t in stages.items() if len(t) == len(nodes)}
+
+
+def checkScaling(nodes, stages, tolerance, min_seconds):
+    """
+    Fit the exponent of every stage (see :func:`fitExponent`).
+
+    **Parameters**
+        ``nodes`` (:class:`python:list` of int)
+            The number of nodes of every size.
+
+        ``stages`` (:class:`python:dict`)
+            The seconds of every stage at every size, keyed by stage.
+
+        ``tolerance`` (float)
+            How much the exponent of a stage may exceed ``1`` (``n log n``).
+
+        ``min_seconds`` (float)
+            Stages faster than this at the largest size never fail.
+
+    **Return**
+        :class:`python:list` of ``(stage, exponent, largest, failed)``
+            Every stage, sorted by name.
+    """
+    results = []
+    for stage in sorted(stages):
+        exponent = fitExponent(nodes, stages[stage])
+        largest = stages[stage][-1]
+        results.append((stage, exponent, largest, exponent > 1.0 + tolerance and largest >= min_seconds))
+    return results
+
+
+def main(argv=None):
+    """
+    Entry point for ``python -m testing.complexity``, run with ``--help`` for the
+    options.
+
+    **Parameters**
+        ``argv`` (:class:`python:list` of str or ``None``)
+            The command line arguments, ``sys.argv[1:]`` when ``None``.
+
+    **Return**
+        int
+            ``1`` when a stage scaled worse than ``n log n``, otherwise ``0``.
+    """
+    parser = argparse.ArgumentParser(
+        prog="python -m testing.complexity",
+        description="Fit how every stage of parsing and generating scales."
+    )
+    parser.add_argument(
+        "scalings", nargs="*", default=sorted(SCALINGS),
+        help="The ways to grow: {0} (default: all).".format(", ".join(sorted(SCALINGS)))
+    )
+    parser.add_argument(
+        "--sizes", type=int, nargs="+", default=list(SIZES), help="default: %(default)s"
+    )
+    parser.add_argument("-r", "--repeat", type=int, default=3, help="default: %(default)s")
+    parser.add_argument(
+        "-t", "--tolerance", type=float, default=0.3,
+        help="How much the exponent may exceed n log n (default: %(default)s)."
+    )
+    parser.add_argument(
+        "--min-seconds", type=float, default=MIN_SECONDS,
+        help="Stages faster than this at the largest size never fail (default: %(default)s)."
+    )
+    parser.add_argument(
+        "-w", "--workdir", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), ".complexity"),
+        help="Where to generate (default: %(default)s)."
+    )
+    args = parser.parse_args(argv)
+    if len(set(args.sizes)) < 2:
+        parser.error("At least two different sizes are needed.")
+
+    failed = False
+    sys.stdout.write("{0:<12} {1:<34} {2:>8} {3:>9}\n".format("scaling", "stage", "exponent", "largest"))
+    for scaling in args.scalings:
+        if scaling not in SCALINGS:
+            parser.error("Unknown scaling '{0}'.".format(scaling))
+        nodes, stages = measureScaling(
+            scaling, sorted(set(args.sizes)), os.path.join(os.path.abspath(args.workdir), scaling), args.repeat
+        )
+        for stage, exponent, largest, stage_failed in checkScaling(
+                nodes, stages, args.tolerance, args.min_seconds):
+            failed = failed or stage_failed
+            sys.stdout.write("{0:<12} {1:<34} {2:>8.2f} {3:>8.4f}s{4}\n".format(
+                scaling, stage, exponent, largest, "  FAILED" if stage_failed else ""
+            ))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
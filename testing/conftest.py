@@ -22,6 +22,14 @@ pytest_plugins = [
 """Signals to ``pytest`` which plugins are needed for all tests."""
 
 
+def pytest_addoption(parser):
+    """Add ``--complexity``, see :mod:`testing.complexity`."""
+    parser.addoption(
+        "--complexity", action="store_true", default=False,
+        help="Fit how every stage of parsing and generating scales (slow)."
+    )
+
+
 def pytest_configure(config):
     """Register ``@pytest.mark.exhale`` with PyTest."""
     config.addinivalue_line(
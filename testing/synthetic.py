@@ -0,0 +1,564 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+"""
+Generate synthetic Doxygen XML of any size, without running Doxygen.
+
+The projects in ``testing/projects`` are tiny, this writes ``index.xml`` and a
+``{refid}.xml`` document per compound laid out the way Doxygen would for a C++ project
+with nested namespaces, class templates and their specializations, overloaded
+functions, and a directory per namespace, as well as the ``combine.xslt`` Doxygen
+writes (see :data:`~exhale.configs.doxygenCombinedXML`).  The output is the same for
+the same parameters, so it can be used to measure how Exhale scales::
+
+    $ python -m testing.synthetic --namespace-depth 4 --namespace-fanout 6 \\
+          --classes-per-namespace 8 build/synthetic/xml
+    Wrote 24865 compounds to [build/synthetic/xml].
+
+The paths in every ``<location>`` are relative (as if Doxygen ran with
+``STRIP_FROM_PATH`` set to the project root), e.g., ``include/n0_1/header0.hpp``.
+Pass the directory as ``--xml-dir`` to ``exhale`` (see :mod:`exhale.cli`), or set
+``breathe_projects`` to it with ``exhaleExecutesDoxygen`` disabled.
+"""
+
+from __future__ import unicode_literals
+
+import argparse
+import codecs
+import hashlib
+import os
+import sys
+from xml.sax.saxutils import escape
+
+__all__ = ["SyntheticProject", "doxygenRefid", "main"]
+
+
+_XML_HEADER = "<?xml version='1.0' encoding='UTF-8' standalone='no'?>\n"
+_DOXYGEN_ATTRS = (
+    'xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance" '
+    'xsi:noNamespaceSchemaLocation="{0}.xsd" version="1.9.1" xml:lang="en-US"'
+)
+
+# The types specializations are made for, and that overloads take, in order.
+_SPECIALIZATION_TYPES = ("int", "float", "double", "char", "bool", "long", "short", "unsigned")
+_PARAMETER_TYPES = ("int", "double", "const std::string &", "std::size_t", "float", "bool")
+
+
+# What Doxygen writes to combine.xslt, verbatim.
+_COMBINE_XSLT = """<!-- XSLT script to combine the generated output into a single file.
+     If you have xsltproc you could use:
+     xsltproc combine.xslt index.xml >all.xml
+-->
+<xsl:stylesheet xmlns:xsl="http://www.w3.org/1999/XSL/Transform" version="1.0">
+  <xsl:output method="xml" version="1.0" indent="no" standalone="yes" />
+  <xsl:template match="/">
+    <doxygen version="{doxygenindex/@version}" xml:lang="{doxygenindex/@xml:lang}">
+      <xsl:for-each select="doxygenindex/compound">
+        <xsl:copy-of select="document( concat( @refid, '.xml' ) )/doxygen/*" />
+      </xsl:for-each>
+    </doxygen>
+  </xsl:template>
+</xsl:stylesheet>
+"""
+
+
+def doxygenRefid(prefix, name):
+    """
+    Escape ``name`` the way Doxygen does in the ``refid`` of a compound.
+
+    **Parameters**
+        ``prefix`` (str)
+            The kind prefix, e.g. ``"class"`` or ``"namespace"`` (empty for files).
+
+        ``name`` (str)
+            The qualified name (or path of a file).
+
+    **Return**
+        str
+            E.g., ``doxygenRefid("class", "n0::Widget< int >")`` is
+            ``"classn0_1_1Widget_3_01int_01_4"``.
+    """
+    escaped = name.replace("_", "__").replace("::", "_1_1").replace("/", "_2")
+    escaped = escaped.replace("<", "_3").replace(">", "_4").replace(" ", "_01").replace(",", "_00")
+    escaped = escaped.replace(".", "_8")
+    return prefix + escaped
+
+
+def _namespaceName(path):
+    # e.g. (0, 1) is n0_0::n1_1
+    return "::".join("n{0}_{1}".format(depth, k) for depth, k in enumerate(path))
+
+
+def _directory(namespace_name):
+    # The directory of every namespace, e.g. include/n0_0/n1_1
+    return "/".join(["include"] + namespace_name.split("::"))
+
+
+def _dirRefid(directory):
+    return "dir_" + hashlib.md5(directory.encode("utf-8")).hexdigest()
+
+
+def _memberRefid(compound_refid, signature):
+    # Doxygen appends a hash of the member's signature to the compound refid.
+    return "{0}_1a{1}".format(compound_refid, hashlib.md5(signature.encode("utf-8")).hexdigest())
+
+
+class _Namespace(object):
+    # Everything in one namespace, which has a directory of its own.
+    def __init__(self, project, path):
+        self.path      = path
+        self.name      = _namespaceName(path)
+        self.refid     = doxygenRefid("namespace", self.name)
+        self.directory = _directory(self.name)
+        self.dir_refid = _dirRefid(self.directory)
+        self.children  = []
+        if len(path) < project.namespace_depth:
+            self.children = [path + (k,) for k in range(project.namespace_fanout)]
+
+        self.files = [
+            "{0}/header{1}.hpp".format(self.directory, j) for j in range(project.files_per_directory)
+        ]
+
+        # (name, refid, template, file index); specializations follow their template.
+        self.classes = []
+        for c in range(project.classes_per_namespace):
+            name = "{0}::Widget{1}".format(self.name, c)
+            template = c % 2 == 0 and project.template_specializations > 0
+            self.classes.append((name, doxygenRefid("class", name), template, c % len(self.files)))
+            if template:
+                for s in range(project.template_specializations):
+                    t = _SPECIALIZATION_TYPES[s % len(_SPECIALIZATION_TYPES)]
+                    if s >= len(_SPECIALIZATION_TYPES):
+                        t = "std::array< {0}, {1} >".format(t, s)
+                    spec = "{0}< {1} >".format(name, t)
+                    self.classes.append((spec, doxygenRefid("class", spec), False, c % len(self.files)))
+
+        # (name, refid, parameters, template, file index) for every overload
+        self.functions = []
+        for k in range(project.functions_per_namespace):
+            name = "compute{0}".format(k)
+            for o in range(project.overloads_per_function):
+                parameters = [
+                    _PARAMETER_TYPES[(k + p) % len(_PARAMETER_TYPES)] for p in range(o + 1)
+                ]
+                signature = "{0}::{1}({2})".format(self.name, name, ", ".join(parameters))
+                self.functions.append(
+                    (name, _memberRefid(self.refid, signature), parameters, k % 2 == 1, k % len(self.files))
+                )
+
+
+class SyntheticProject(object):
+    """
+    The parameters of the synthetic project, see :func:`SyntheticProject.write`.
+
+    **Parameters**
+        ``namespace_depth`` (int)
+            How deeply namespaces nest, ``1`` for only top-level namespaces.
+
+        ``namespace_fanout`` (int)
+            How many namespaces are at the top level, and in every namespace that is not
+            at the deepest level.
+
+        ``classes_per_namespace`` (int)
+            How many classes every namespace has.  Every other class is a class template.
+
+        ``functions_per_namespace`` (int)
+            How many (differently named) functions every namespace has.
+
+        ``overloads_per_function`` (int)
+            How many overloads every function has.
+
+        ``files_per_directory`` (int)
+            How many headers the directory of every namespace has, the classes and
+            functions are distributed between them.
+
+        ``template_specializations`` (int)
+            How many specializations every class template has, each is a compound.
+
+        ``program_listing_lines`` (int)
+            How many lines the program listing of every file has (at least the lines
+            declaring what is in it).
+    """
+    def __init__(self, namespace_depth=2, namespace_fanout=3, classes_per_namespace=4,
+                 functions_per_namespace=2, overloads_per_function=2, files_per_directory=2,
+                 template_specializations=1, program_listing_lines=40):
+        self.namespace_depth          = namespace_depth
+        self.namespace_fanout         = namespace_fanout
+        self.classes_per_namespace    = classes_per_namespace
+        self.functions_per_namespace  = functions_per_namespace
+        self.overloads_per_function   = overloads_per_function
+        self.files_per_directory      = files_per_directory
+        self.template_specializations = template_specializations
+        self.program_listing_lines    = program_listing_lines
+        if namespace_depth < 1 or namespace_fanout < 1 or files_per_directory < 1:
+            raise ValueError("The namespace depth, fanout, and files per directory must be at least 1.")
+
+    def namespaces(self):
+        """
+        **Return**
+            generator of ``_Namespace``
+                Every namespace, parents before their children.
+        """
+        pending = [(k,) for k in reversed(range(self.namespace_fanout))]
+        while pending:
+            namespace = _Namespace(self, pending.pop())
+            pending.extend(reversed(namespace.children))
+            yield namespace
+
+    def counts(self):
+        """
+        **Return**
+            :class:`python:dict`
+                How many compounds (and functions) of every kind :func:`write` creates,
+                keyed by Doxygen kind.
+        """
+        namespaces = sum(self.namespace_fanout ** d for d in range(1, self.namespace_depth + 1))
+        templates = (self.classes_per_namespace + 1) // 2 if self.template_specializations else 0
+        return {
+            "namespace": namespaces,
+            "class": namespaces * (self.classes_per_namespace + templates * self.template_specializations),
+            "function": namespaces * self.functions_per_namespace * self.overloads_per_function,
+            "file": namespaces * self.files_per_directory,
+            "dir": namespaces + 1
+        }
+
+    def write(self, xml_dir):
+        """
+        Write ``index.xml``, every ``{refid}.xml``, and ``combine.xslt`` to ``xml_dir``.  Documents are
+        written as they are created, memory does not grow with the size of the project.
+
+        **Parameters**
+            ``xml_dir`` (str)
+                The directory to write to, created if needed.
+
+        **Return**
+            int
+                How many compounds were written.
+        """
+        if not os.path.isdir(xml_dir):
+            os.makedirs(xml_dir)
+        compounds = 0
+        with codecs.open(os.path.join(xml_dir, "index.xml"), "w", "utf-8") as index:
+            index.write(_XML_HEADER)
+            index.write("<doxygenindex {0}>\n".format(_DOXYGEN_ATTRS.format("index")))
+
+            root_dirs = []
+            for namespace in self.namespaces():
+                if len(namespace.path) == 1:
+                    root_dirs.append(namespace)
+                compounds += self._writeNamespace(xml_dir, index, namespace)
+
+            inner = "".join(
+                '    <innerdir refid="{0}">{1}</innerdir>\n'.format(n.dir_refid, n.directory)
+                for n in root_dirs
+            )
+            self._writeDir(xml_dir, index, _dirRefid("include"), "include", inner)
+            compounds += 1
+
+            index.write("</doxygenindex>\n")
+        with codecs.open(os.path.join(xml_dir, "combine.xslt"), "w", "utf-8") as combine:
+            combine.write(_COMBINE_XSLT)
+        return compounds
+
+    def _writeCompound(self, xml_dir, refid, compounddef):
+        with codecs.open(os.path.join(xml_dir, refid + ".xml"), "w", "utf-8") as document:
+            document.write(_XML_HEADER)
+            document.write("<doxygen {0}>\n".format(_DOXYGEN_ATTRS.format("compound")))
+            document.write(compounddef)
+            document.write("</doxygen>\n")
+
+    def _writeDir(self, xml_dir, index, refid, directory, inner):
+        index.write('  <compound refid="{0}" kind="dir"><name>{1}</name>\n  </compound>\n'.format(
+            refid, directory
+        ))
+        self._writeCompound(xml_dir, refid, (
+            '  <compounddef id="{0}" kind="dir">\n'
+            '    <compoundname>{1}</compoundname>\n'
+            '{2}'
+            '    <briefdescription>\n    </briefdescription>\n'
+            '    <detaileddescription>\n    </detaileddescription>\n'
+            '    <location file="{1}/"/>\n'
+            '  </compounddef>\n'
+        ).format(refid, directory, inner))
+
+    def _functionMemberdef(self, namespace, function, line):
+        name, refid, parameters, template, f = function
+        params = "".join(
+            "        <param>\n          <type>{0}</type>\n          <declname>arg{1}</declname>\n"
+            "        </param>\n".format(escape(t), p) for p, t in enumerate(parameters)
+        )
+        templateparamlist = ""
+        if template:
+            templateparamlist = (
+                "        <templateparamlist>\n"
+                "          <param>\n            <type>typename T</type>\n          </param>\n"
+                "        </templateparamlist>\n"
+            )
+        argsstring = "({0})".format(", ".join("{0} arg{1}".format(t, p) for p, t in enumerate(parameters)))
+        return (
+            '      <memberdef kind="function" id="{refid}" prot="public" static="no" const="no" '
+            'explicit="no" inline="no" virt="non-virtual">\n'
+            '{templateparamlist}'
+            '        <type>int</type>\n'
+            '        <definition>int {namespace}::{name}</definition>\n'
+            '        <argsstring>{argsstring}</argsstring>\n'
+            '        <name>{name}</name>\n'
+            '        <qualifiedname>{namespace}::{name}</qualifiedname>\n'
+            '{params}'
+            '        <briefdescription>\n<para>Overload {refid_tail} of {name}.</para>\n'
+            '        </briefdescription>\n'
+            '        <detaileddescription>\n        </detaileddescription>\n'
+            '        <inbodydescription>\n        </inbodydescription>\n'
+            '        <location file="{file}" line="{line}" column="5" declfile="{file}" '
+            'declline="{line}" declcolumn="5"/>\n'
+            '      </memberdef>\n'
+        ).format(
+            refid=refid, templateparamlist=templateparamlist, namespace=namespace.name, name=name,
+            argsstring=escape(argsstring), params=params, refid_tail=refid[-6:],
+            file=namespace.files[f], line=line
+        )
+
+    def _writeNamespace(self, xml_dir, index, namespace):
+        compounds = 0
+
+        # The namespace, listing its functions as members.
+        index.write('  <compound refid="{0}" kind="namespace"><name>{1}</name>\n'.format(
+            namespace.refid, namespace.name
+        ))
+        member = '    <member refid="{0}" kind="function"><name>{1}</name></member>\n'
+        for name, refid, _, _, _ in namespace.functions:
+            index.write(member.format(refid, name))
+        index.write("  </compound>\n")
+        inner = "".join(
+            '    <innerclass refid="{0}" prot="public">{1}</innerclass>\n'.format(refid, escape(name))
+            for name, refid, _, _ in namespace.classes
+        )
+        inner += "".join(
+            '    <innernamespace refid="{0}">{1}</innernamespace>\n'.format(
+                doxygenRefid("namespace", child), child
+            ) for child in (_namespaceName(c) for c in namespace.children)
+        )
+        functions = "".join(
+            self._functionMemberdef(namespace, function, 20 + i)
+            for i, function in enumerate(namespace.functions)
+        )
+        if functions:
+            functions = '      <sectiondef kind="func">\n{0}      </sectiondef>\n'.format(functions)
+        self._writeCompound(xml_dir, namespace.refid, (
+            '  <compounddef id="{0}" kind="namespace" language="C++">\n'
+            '    <compoundname>{1}</compoundname>\n'
+            '{2}{3}'
+            '    <briefdescription>\n<para>The {1} namespace.</para>\n    </briefdescription>\n'
+            '    <detaileddescription>\n    </detaileddescription>\n'
+            '    <location file="{4}" line="3" column="1"/>\n'
+            '  </compounddef>\n'
+        ).format(namespace.refid, namespace.name, inner, functions, namespace.files[0]))
+        compounds += 1
+
+        # Every class (and specialization), with a couple of methods.
+        for c, (name, refid, template, f) in enumerate(namespace.classes):
+            methods = []
+            for method in ("get", "set"):
+                method_refid = _memberRefid(refid, "{0}::{1}".format(name, method))
+                methods.append((method, method_refid))
+            index.write('  <compound refid="{0}" kind="class"><name>{1}</name>\n'.format(refid, escape(name)))
+            for method, method_refid in methods:
+                index.write(member.format(method_refid, method))
+            index.write("  </compound>\n")
+
+            templateparamlist = ""
+            if template:
+                templateparamlist = (
+                    "    <templateparamlist>\n"
+                    "      <param>\n        <type>typename T</type>\n      </param>\n"
+                    "    </templateparamlist>\n"
+                )
+            elif "<" in name:
+                templateparamlist = "    <templateparamlist>\n    </templateparamlist>\n"
+            memberdefs = "".join(
+                '      <memberdef kind="function" id="{0}" prot="public" static="no" const="{1}" '
+                'explicit="no" inline="no" virt="non-virtual">\n'
+                '        <type>int</type>\n'
+                '        <definition>int {2}::{3}</definition>\n'
+                '        <argsstring>(){4}</argsstring>\n'
+                '        <name>{3}</name>\n'
+                '        <briefdescription>\n        </briefdescription>\n'
+                '        <detaileddescription>\n        </detaileddescription>\n'
+                '        <inbodydescription>\n        </inbodydescription>\n'
+                '        <location file="{5}" line="{6}" column="9"/>\n'
+                '      </memberdef>\n'.format(
+                    method_refid, "yes" if method == "get" else "no", escape(name), method,
+                    " const" if method == "get" else "", namespace.files[f], 40 + 10 * c + m
+                ) for m, (method, method_refid) in enumerate(methods)
+            )
+            header = namespace.files[f][len("include/"):]
+            self._writeCompound(xml_dir, refid, (
+                '  <compounddef id="{0}" kind="class" language="C++" prot="public">\n'
+                '    <compoundname>{1}</compoundname>\n'
+                '    <includes local="no">{2}</includes>\n'
+                '{3}'
+                '      <sectiondef kind="public-func">\n{4}      </sectiondef>\n'
+                '    <briefdescription>\n<para>A synthetic class.</para>\n    </briefdescription>\n'
+                '    <detaileddescription>\n<para>Generated by testing.synthetic.</para>\n'
+                '    </detaileddescription>\n'
+                '    <location file="{5}" line="{6}" column="1" bodyfile="{5}" bodystart="{6}" '
+                'bodyend="{7}"/>\n'
+                '  </compounddef>\n'
+            ).format(
+                refid, escape(name), header, templateparamlist, memberdefs, namespace.files[f],
+                38 + 10 * c, 46 + 10 * c
+            ))
+            compounds += 1
+
+        # Every file, each including the previous one in the directory.
+        for j, path in enumerate(namespace.files):
+            refid = doxygenRefid("", path[len("include/"):])
+            basename = os.path.basename(path)
+            in_file = [fn for fn in namespace.functions if fn[4] == j]
+            classes = [c for c in namespace.classes if c[3] == j]
+            index.write('  <compound refid="{0}" kind="file"><name>{1}</name>\n'.format(refid, basename))
+            for name, function_refid, _, _, _ in in_file:
+                index.write(member.format(function_refid, name))
+            index.write("  </compound>\n")
+
+            includes = '    <includes local="no">vector</includes>\n'
+            includes += '    <includes local="no">string</includes>\n'
+            if j > 0:
+                previous = namespace.files[j - 1][len("include/"):]
+                includes += '    <includes refid="{0}" local="yes">{1}</includes>\n'.format(
+                    doxygenRefid("", previous), previous
+                )
+            if j + 1 < len(namespace.files):
+                following = namespace.files[j + 1][len("include/"):]
+                includes += '    <includedby refid="{0}" local="yes">{1}</includedby>\n'.format(
+                    doxygenRefid("", following), following
+                )
+            inner = "".join(
+                '    <innerclass refid="{0}" prot="public">{1}</innerclass>\n'.format(c_refid, escape(name))
+                for name, c_refid, _, _ in classes
+            )
+            inner += '    <innernamespace refid="{0}">{1}</innernamespace>\n'.format(
+                namespace.refid, namespace.name
+            )
+            functions = "".join(
+                self._functionMemberdef(namespace, function, 20 + i) for i, function in enumerate(in_file)
+            )
+            if functions:
+                functions = '      <sectiondef kind="func">\n{0}      </sectiondef>\n'.format(functions)
+            self._writeCompound(xml_dir, refid, (
+                '  <compounddef id="{0}" kind="file" language="C++">\n'
+                '    <compoundname>{1}</compoundname>\n'
+                '{2}{3}{4}'
+                '    <briefdescription>\n    </briefdescription>\n'
+                '    <detaileddescription>\n    </detaileddescription>\n'
+                '    <programlisting>\n{5}    </programlisting>\n'
+                '    <location file="{6}"/>\n'
+                '  </compounddef>\n'
+            ).format(
+                refid, basename, includes, inner, functions,
+                self._programListing(namespace, classes, in_file), path
+            ))
+            compounds += 1
+
+        # The directory of the namespace.
+        inner = "".join(
+            '    <innerdir refid="{0}">{1}</innerdir>\n'.format(_dirRefid(child), child)
+            for child in (_directory(_namespaceName(c)) for c in namespace.children)
+        )
+        inner += "".join(
+            '    <innerfile refid="{0}">{1}</innerfile>\n'.format(
+                doxygenRefid("", path[len("include/"):]), os.path.basename(path)
+            ) for path in namespace.files
+        )
+        self._writeDir(xml_dir, index, namespace.dir_refid, namespace.directory, inner)
+        compounds += 1
+        return compounds
+
+    def _programListing(self, namespace, classes, functions):
+        def codeline(number, highlighted, refid=None):
+            ref = ' refid="{0}" refkind="compound"'.format(refid) if refid else ""
+            return '<codeline lineno="{0}"{1}>{2}</codeline>\n'.format(number, ref, highlighted)
+
+        lines = [
+            '<highlight class="preprocessor">#pragma<sp/>once</highlight>',
+            '<highlight class="normal"></highlight>',
+            '<highlight class="keyword">namespace</highlight><highlight class="normal"><sp/>{0}<sp/>{{'
+            '</highlight>'.format(namespace.name)
+        ]
+        refids = [None] * len(lines)
+        for name, refid, _, _ in classes:
+            lines.append(
+                '<highlight class="keyword">class<sp/></highlight><highlight class="normal">'
+                '<ref refid="{0}" kindref="compound">{1}</ref><sp/>{{}};</highlight>'.format(
+                    refid, escape(name[len(namespace.name) + 2:]).replace(" ", "<sp/>")
+                )
+            )
+            refids.append(refid)
+        for name, refid, parameters, _, _ in functions:
+            lines.append(
+                '<highlight class="keywordtype">int</highlight><highlight class="normal"><sp/>'
+                '<ref refid="{0}" kindref="member">{1}</ref>({2});</highlight>'.format(
+                    refid, name, escape(", ".join(parameters)).replace(" ", "<sp/>")
+                )
+            )
+            refids.append(None)
+        lines.append(
+            '<highlight class="normal">}}<sp/>//<sp/>namespace<sp/>{0}</highlight>'.format(namespace.name)
+        )
+        refids.append(None)
+        for n in range(len(lines), self.program_listing_lines):
+            lines.append(
+                '<highlight class="comment">//<sp/>synthetic<sp/>line<sp/>{0}</highlight>'.format(n + 1)
+            )
+            refids.append(None)
+        return "".join(codeline(n + 1, line, refid) for n, (line, refid) in enumerate(zip(lines, refids)))
+
+
+def main(argv=None):
+    """
+    Entry point for ``python -m testing.synthetic``, run with ``--help`` for the
+    options (the parameters of :class:`SyntheticProject`).
+
+    **Parameters**
+        ``argv`` (:class:`python:list` of str or ``None``)
+            The command line arguments, ``sys.argv[1:]`` when ``None``.
+
+    **Return**
+        int
+            The process exit code.
+    """
+    defaults = SyntheticProject()
+    parser = argparse.ArgumentParser(
+        prog="python -m testing.synthetic",
+        description="Write synthetic Doxygen XML (index.xml and a document per compound)."
+    )
+    parser.add_argument("xml_dir", help="The directory to write the Doxygen XML to.")
+    for option in ("namespace_depth", "namespace_fanout", "classes_per_namespace",
+                   "functions_per_namespace", "overloads_per_function", "files_per_directory",
+                   "template_specializations", "program_listing_lines"):
+        parser.add_argument(
+            "--" + option.replace("_", "-"), type=int, default=getattr(defaults, option),
+            help="default: %(default)s"
+        )
+    parser.add_argument(
+        "--counts", action="store_true", help="Only print how many compounds would be written."
+    )
+    args = vars(parser.parse_args(argv))
+    xml_dir = args.pop("xml_dir")
+    only_counts = args.pop("counts")
+    project = SyntheticProject(**args)
+    if only_counts:
+        for kind, count in sorted(project.counts().items()):
+            sys.stdout.write("{0:>10}  {1}\n".format(count, kind))
+        return 0
+    compounds = project.write(xml_dir)
+    sys.stdout.write("Wrote {0} compounds to [{1}].\n".format(compounds, xml_dir))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,58 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+"""
+Tests for the benchmark runner of :mod:`testing.benchmark`.
+"""
+from __future__ import unicode_literals
+
+import json
+
+from testing.benchmark import PHASES, benchmarkSynthetic, compareToBaseline, main
+from testing.synthetic import SyntheticProject
+
+
+def test_compare_to_baseline():
+    """A phase regresses when it is slower by both the threshold and the noise floor."""
+    baseline = {"a": {"parse": 1.0, "generateFullAPI": 0.001}, "b": {"parse": 1.0}}
+    results = {
+        "a": {"parse": 1.3, "generateFullAPI": 0.005},  # 500% slower, but only 4ms
+        "b": {"parse": 1.1, "generateFullAPI": 9.0},    # within threshold, not in baseline
+        "c": {"parse": 5.0, "generateFullAPI": 5.0}     # not in baseline
+    }
+    assert compareToBaseline(results, baseline, 0.2, 0.01) == [("a", "parse", 1.0, 1.3)]
+    assert compareToBaseline(results, baseline, 0.5, 0.01) == []
+    assert compareToBaseline(results, baseline, 0.2, 0.001) == [
+        ("a", "parse", 1.0, 1.3), ("a", "generateFullAPI", 0.001, 0.005)
+    ]
+
+
+def test_benchmark_synthetic(tmp_path):
+    """Every phase of a small synthetic project is timed, and baselines round trip."""
+    project = SyntheticProject(namespace_depth=1, namespace_fanout=2)
+    results = benchmarkSynthetic("tiny", project, str(tmp_path / "tiny"), 2)
+    assert sorted(results) == sorted(PHASES)
+    assert all(seconds > 0 for seconds in results.values())
+
+    baseline = tmp_path / "baseline.json"
+    workdir = str(tmp_path / "work")
+    args = ["synthetic_small", "--repeat", "1", "--baseline", str(baseline), "--workdir", workdir]
+    assert main(args + ["--save"]) == 0
+    saved = json.loads(baseline.read_text())
+    assert sorted(saved["cases"]["synthetic_small"]) == sorted(PHASES)
+
+    # Nothing regresses against a baseline that took forever.
+    for phase in PHASES:
+        saved["cases"]["synthetic_small"][phase] = 3600.0
+    baseline.write_text(json.dumps(saved))
+    assert main(args) == 0
+
+    # Everything regresses against a baseline that took no time.
+    for phase in PHASES:
+        saved["cases"]["synthetic_small"][phase] = 0.0
+    baseline.write_text(json.dumps(saved))
+    assert main(args + ["--min-seconds", "0"]) == 1
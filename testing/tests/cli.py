@@ -0,0 +1,83 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+"""
+Tests for the standalone :mod:`exhale.cli` entry point.
+"""
+from __future__ import unicode_literals
+import os
+import textwrap
+
+from exhale import configs
+from exhale.cli import generated_outputs, load_config_file, write_depfile, xml_inputs
+
+from testing import get_exhale_root
+from testing.base import ExhaleTestCase
+
+
+def test_load_config_file(tmp_path):
+    """Verify both python and json configuration files can be loaded."""
+    conf_py = tmp_path / "conf.py"
+    conf_py.write_text(textwrap.dedent('''\
+        import os
+        here = os.path.basename(os.path.abspath(os.curdir))
+        exhale_args = {"containmentFolder": "./api"}
+    '''))
+    values = load_config_file(str(conf_py))
+    assert values["exhale_args"] == {"containmentFolder": "./api"}
+    # Executed from the directory of the file, like sphinx does.
+    assert values["here"] == tmp_path.name
+
+    conf_json = tmp_path / "exhale.json"
+    conf_json.write_text('{"exhale_args": {"rootFileName": "root.rst"}}')
+    assert load_config_file(str(conf_json)) == {"exhale_args": {"rootFileName": "root.rst"}}
+
+
+def test_write_depfile(tmp_path):
+    """Verify the depfile is escaped and formatted as Make / Ninja expect."""
+    depfile = tmp_path / "sub" / "exhale.d"
+    write_depfile(str(depfile), ["api/root.rst"], ["xml/index.xml", "x m l/$a.xml"])
+    assert depfile.read_text() == (
+        "api/root.rst: \\\n"
+        "  xml/index.xml \\\n"
+        "  x\\ m\\ l/$$a.xml\n"
+    )
+
+
+class CLIGraphQueries(ExhaleTestCase):
+    """
+    Validate the inputs / outputs reported for a depfile.
+    """
+
+    test_project = "cpp_nesting"
+    """
+    .. testproject:: cpp_nesting
+
+    .. note::
+
+        The ``cpp_nesting`` project is just being recycled, the tests for that project
+        take place in
+        :class:`CPPNesting <testing.tests.cpp_nesting.CPPNesting>`.
+    """
+
+    def test_inputs_and_outputs(self):
+        """Every input is a Doxygen XML document, every generated document is an output."""
+        root = get_exhale_root(self)
+        inputs = xml_inputs(root)
+        self.assertTrue(os.path.join(configs._doxygen_xml_output_directory, "index.xml") in inputs)
+        for node in root.all_nodes:
+            if node.kind in {"class", "struct", "file", "namespace"}:
+                self.assertTrue(
+                    os.path.join(configs._doxygen_xml_output_directory, node.refid + ".xml") in inputs
+                )
+
+        outputs = generated_outputs(root)
+        self.assertTrue(root.full_root_file_path in outputs)
+        containmentFolder = self.getAbsContainmentFolder()
+        for dirpath, _, filenames in os.walk(containmentFolder):
+            for f in filenames:
+                self.assertTrue(os.path.join(dirpath, f) in outputs)
@@ -0,0 +1,51 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+"""
+Tests for how parsing and generating scale, see :mod:`testing.complexity`.
+"""
+from __future__ import unicode_literals
+
+import math
+
+import pytest
+
+from testing.complexity import MIN_SECONDS, SCALINGS, SIZES, checkScaling, fitExponent, measureScaling
+
+
+def test_fit_exponent():
+    """Linear, ``n log n``, and quadratic growth are told apart."""
+    sizes = [150, 300, 600, 1200]
+    assert fitExponent(sizes, [1e-4 * n for n in sizes], log_factor=False) == pytest.approx(1.0)
+    assert fitExponent(sizes, [1e-6 * n * n for n in sizes], log_factor=False) == pytest.approx(2.0)
+    assert fitExponent(sizes, [1e-5 * n * math.log(n) for n in sizes]) == pytest.approx(1.0)
+    assert fitExponent(sizes, [1e-4 * n for n in sizes]) < 1.0
+
+    stages = {
+        "linear": [1e-4 * n for n in sizes],
+        "quadratic": [1e-6 * n * n for n in sizes],
+        "tiny": [1e-9 * n * n for n in sizes]  # quadratic, but too fast to fail
+    }
+    failed = [stage for stage, _, _, f in checkScaling(sizes, stages, 0.3, MIN_SECONDS) if f]
+    assert failed == ["quadratic"]
+
+    with pytest.raises(ValueError):
+        fitExponent([10, 10], [1.0, 2.0])
+
+
+@pytest.mark.parametrize("scaling", sorted(SCALINGS))
+def test_complexity(request, tmp_path, scaling):
+    """No stage of parsing or generating scales worse than ``n log n``."""
+    if not request.config.getoption("--complexity"):
+        pytest.skip("pass --complexity to fit how every stage scales")
+    nodes, stages = measureScaling(scaling, SIZES, str(tmp_path / scaling), 2)
+    assert "discoverAllNodes" in stages and "generateFullAPI" in stages
+    failed = [
+        "{0} (exponent {1:.2f})".format(stage, exponent)
+        for stage, exponent, _, f in checkScaling(nodes, stages, 0.3, MIN_SECONDS) if f
+    ]
+    assert not failed, "Scaling worse than n log n: " + ", ".join(failed)
@@ -10,6 +10,7 @@ Tests for validating error handling with configs set in ``conf.py``.
 """
 from __future__ import unicode_literals
 import re
+import shutil
 import textwrap
 from pathlib import Path
 
@@ -174,6 +175,53 @@ class ConfigurationWarningTests(ExhaleTestCase):
         )
 
 
+@confoverrides(exhale_args={"verboseBuild": True})
+class VerboseBuildTests(ExhaleTestCase):
+    """
+    Tests for where :data:`~exhale.configs.verboseBuild` output is written.
+    """
+
+    test_project = "cpp_nesting"
+    """
+    .. testproject:: cpp_nesting
+
+    .. note::
+
+        The ``cpp_nesting`` project is just being recycled, the tests for that project
+        take place in
+        :class:`CPPNesting <testing.tests.cpp_nesting.CPPNesting>`.
+    """
+
+    doxygen_input_message = "The following input will be sent to Doxygen:"
+    """Verbose message logged before running Doxygen."""
+
+    def test_verbose_status(self):
+        """
+        Verify verbose output is logged through Sphinx.
+        """
+        sphinx_status = self.app._status.getvalue()
+        assert self.doxygen_input_message in sphinx_status
+        assert "had [" in sphinx_status
+
+    @confoverrides(exhale_args={"verboseBuildFile": "_verbose/exhale.log"})
+    def test_verbose_file(self):
+        """
+        Verify verbose output is written to ``verboseBuildFile`` (without color) instead.
+        """
+        from exhale import configs
+
+        verbose_file = Path(configs.verboseBuildFile)
+        try:
+            assert verbose_file.is_absolute()
+            contents = verbose_file.read_text(encoding="utf-8")
+            assert self.doxygen_input_message in contents
+            assert "had [" in contents
+            assert "\033[" not in contents
+            assert self.doxygen_input_message not in self.app._status.getvalue()
+        finally:
+            shutil.rmtree(str(verbose_file.parent), ignore_errors=True)
+
+
 class ListingExcludeTests(ExhaleTestCase):
     """Test for expected failures when invalid configurations are given in ``conf.py``."""
 
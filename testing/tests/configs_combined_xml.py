@@ -0,0 +1,111 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+"""
+Tests for :data:`~exhale.configs.doxygenCombinedXML`.
+"""
+from __future__ import unicode_literals
+
+import json
+import os
+
+from lxml import etree
+
+from exhale import cli, configs
+from exhale.graph import ExhaleRoot
+
+from testing import get_exhale_root
+from testing.base import ExhaleTestCase
+from testing.synthetic import SyntheticProject
+
+
+def write_combined_xml(xml_dir, combined_path):
+    """
+    Run the ``combine.xslt`` Doxygen wrote to ``xml_dir``, as
+    ``xsltproc combine.xslt index.xml > combined_path`` would.
+    """
+    combine = etree.XSLT(etree.parse(os.path.join(xml_dir, "combine.xslt")))
+    combined = combine(etree.parse(os.path.join(xml_dir, "index.xml")))
+    with open(combined_path, "wb") as combined_file:
+        combined_file.write(bytes(combined))
+
+
+class CombinedXMLTests(ExhaleTestCase):
+    """
+    Verify the graph parsed from a combined document matches the one from ``index.xml``.
+    """
+
+    test_project = "cpp_nesting"
+    """
+    .. testproject:: cpp_nesting
+
+    .. note::
+
+        The ``cpp_nesting`` project is just being recycled, the tests for that project
+        take place in
+        :class:`CPPNesting <testing.tests.cpp_nesting.CPPNesting>`.
+    """
+
+    def test_same_graph(self):
+        """Nodes, relationships, and file listings match the per-refid documents."""
+        root = get_exhale_root(self)
+        combined_path = os.path.join(configs._doxygen_xml_output_directory, "combined.xml")
+        write_combined_xml(configs._doxygen_xml_output_directory, combined_path)
+        try:
+            configs.doxygenCombinedXML = combined_path
+            combined_root = ExhaleRoot()
+            combined_root.parse()
+        finally:
+            configs.doxygenCombinedXML = None
+            os.remove(combined_path)
+
+        def summary(graph):
+            return {
+                n.refid: (
+                    n.name,
+                    n.kind,
+                    n.parent.refid if n.parent else None,
+                    n.def_in_file.refid if n.def_in_file else None,
+                    sorted(c.refid for c in n.children),
+                    getattr(n, "location", None)
+                )
+                for n in graph.all_nodes
+            }
+
+        self.assertEqual(summary(root), summary(combined_root))
+        self.assertTrue(len(combined_root.combined_xml) > 0)
+
+
+def test_synthetic_combined(tmp_path):
+    """
+    The documents generated from the ``combine.xslt`` output of a synthetic project are
+    the ones generated from ``index.xml``, and only where each compound is is kept.
+    """
+    xml_dir = str(tmp_path / "xml")
+    SyntheticProject(namespace_depth=2, namespace_fanout=3).write(xml_dir)
+    write_combined_xml(xml_dir, os.path.join(xml_dir, "combined.xml"))
+
+    generated = {}
+    for combined in (None, "combined.xml"):
+        exhale_args = {
+            "containmentFolder": "./api",
+            "rootFileName": "synthetic_root.rst",
+            "doxygenStripFromPath": ".",
+            "exhaleExecutesDoxygen": False
+        }
+        if combined:
+            exhale_args["doxygenCombinedXML"] = combined
+        config = tmp_path / "conf.json"
+        config.write_text(json.dumps({"exhale_args": exhale_args}))
+        assert cli.main(["--config", str(config), "--xml-dir", xml_dir]) == 0
+        api = tmp_path / "api"
+        generated[combined] = {path.name: path.read_text() for path in api.iterdir()}
+
+    assert generated[None] == generated["combined.xml"]
+    root = configs._the_app.exhale_root
+    assert len(root.combined_xml) > 0
+    assert all(isinstance(span, tuple) for span in root.combined_xml.spans.values())
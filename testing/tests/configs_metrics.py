@@ -0,0 +1,246 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+"""
+Tests for :data:`~exhale.configs.metricsFile`, :data:`~exhale.configs.compoundCostReport`,
+:data:`~exhale.configs.traceFile`, :data:`~exhale.configs.memoryProfileFile`, and
+:mod:`exhale.metrics` (including the I/O budgets of a build).
+"""
+from __future__ import unicode_literals
+
+import codecs
+import json
+import os
+import shutil
+import tracemalloc
+
+import pytest
+
+from exhale import configs, metrics, utils
+from exhale.metrics import COMPOUND_COSTS, DOCUMENT_IO
+
+from testing import get_exhale_root
+from testing.base import ExhaleTestCase
+from testing.decorators import confoverrides
+
+
+@confoverrides(exhale_args={"metricsFile": "_metrics/exhale.json"})
+class MetricsTests(ExhaleTestCase):
+    """
+    Verify the phases of parsing and generating are recorded and written.
+    """
+
+    test_project = "cpp_nesting"
+    """
+    .. testproject:: cpp_nesting
+
+    .. note::
+
+        The ``cpp_nesting`` project is just being recycled, the tests for that project
+        take place in
+        :class:`CPPNesting <testing.tests.cpp_nesting.CPPNesting>`.
+    """
+
+    def test_metrics(self):
+        """Every phase is recorded on the root, and the JSON matches it."""
+        metrics_file = configs.metricsFile
+        try:
+            root = get_exhale_root(self)
+            phases = {p["name"]: p for p in root.metrics.phases}
+            for name in ("doxygen", "parse", "discoverAllNodes", "reparentNamespaces",
+                         "fileRefDiscovery", "parseFunctionSignatures", "sortInternals",
+                         "generateFullAPI", "generateFileNodeDocuments", "generateClassView"):
+                assert name in phases
+                assert phases[name]["seconds"] >= 0
+
+            assert phases["parse"]["depth"] == 0
+            # The phases Doxygen announced are nested in the one that runs it.
+            assert phases["doxygen: Parsing files"]["depth"] == phases["doxygen"]["depth"] + 1
+            assert phases["reparentNamespaces"]["depth"] == 2
+            assert phases["discoverAllNodes"]["nodes"] == len(root.all_nodes)
+            assert phases["parse"]["files_opened"] > 0
+            assert phases["parse"]["documents_parsed"] > 0
+            assert phases["generateFullAPI"]["pages_written"] == root.metrics.counters["pages_written"]
+            assert root.metrics.counters["pages_written"] > 0
+            assert root.metrics.counters["bytes_written"] > 0
+
+            assert os.path.isabs(metrics_file)
+            with codecs.open(metrics_file, "r", "utf-8") as written:
+                contents = json.load(written)
+            assert contents["project"] == "cpp_nesting"
+            assert contents["nodes"]["file"] == len(root.files)
+            assert contents["counters"] == root.metrics.counters
+            assert [p["name"] for p in contents["phases"]] == [p["name"] for p in root.metrics.phases]
+        finally:
+            shutil.rmtree(os.path.dirname(metrics_file), ignore_errors=True)
+
+
+@confoverrides(exhale_args={"metricsFile": "_metrics/exhale.json", "compoundCostReport": 2})
+class CompoundCostTests(ExhaleTestCase):
+    """
+    Verify :data:`~exhale.configs.compoundCostReport` ranks the compounds.
+    """
+
+    test_project = "cpp_nesting"
+    """
+    .. testproject:: cpp_nesting
+
+    .. note::
+
+        The ``cpp_nesting`` project is just being recycled, the tests for that project
+        take place in
+        :class:`CPPNesting <testing.tests.cpp_nesting.CPPNesting>`.
+    """
+
+    def test_compound_costs(self):
+        """Every cost lists the most expensive compounds, with where they are defined."""
+        metrics_file = configs.metricsFile
+        try:
+            root = get_exhale_root(self)
+            compounds = root.metrics.compounds
+            for f in root.files:
+                assert compounds[f.refid]["location"] == f.location
+                assert compounds[f.refid]["parse_bytes"] > 0
+                assert compounds[f.refid]["generate_bytes"] > 0
+            for node in root.class_like:
+                if node.def_in_file is not None:
+                    assert compounds[node.refid]["location"] == node.def_in_file.location
+
+            report = root.metrics.compoundReport()
+            assert sorted(report) == sorted(COMPOUND_COSTS)
+            for cost, entries in report.items():
+                assert len(entries) == 2
+                assert entries[0][cost] >= entries[1][cost]
+                assert all(entries[0][cost] >= e[cost] for e in compounds.values())
+
+            with codecs.open(metrics_file, "r", "utf-8") as written:
+                contents = json.load(written)
+            assert contents["compounds"] == json.loads(json.dumps(report))
+        finally:
+            shutil.rmtree(os.path.dirname(metrics_file), ignore_errors=True)
+
+
+@confoverrides(exhale_args={"traceFile": "_trace/exhale.json"})
+class TraceTests(ExhaleTestCase):
+    """
+    Verify :data:`~exhale.configs.traceFile` writes a span for every phase.
+    """
+
+    test_project = "cpp_nesting"
+    """
+    .. testproject:: cpp_nesting
+
+    .. note::
+
+        The ``cpp_nesting`` project is just being recycled, the tests for that project
+        take place in
+        :class:`CPPNesting <testing.tests.cpp_nesting.CPPNesting>`.
+    """
+
+    def test_trace(self):
+        """The Doxygen subprocess and every phase are spans, phases nest in time."""
+        trace_file = configs.traceFile
+        try:
+            root = get_exhale_root(self)
+            assert metrics.trace() is None
+            with codecs.open(trace_file, "r", "utf-8") as written:
+                events = json.load(written)["traceEvents"]
+            spans = {e["name"]: e for e in events if e["ph"] == "X"}
+            assert spans["doxygen subprocess"]["cat"] == "subprocess"
+            for phase in root.metrics.phases:
+                assert spans[phase["name"]]["cat"] == "phase"
+
+            parse = spans["parse"]
+            for name in ("discoverAllNodes", "fileRefDiscovery", "sortInternals"):
+                assert spans[name]["ts"] >= parse["ts"]
+                assert spans[name]["ts"] + spans[name]["dur"] <= parse["ts"] + parse["dur"]
+            assert spans["doxygen"]["ts"] + spans["doxygen"]["dur"] <= parse["ts"]
+            assert spans["discoverAllNodes"]["args"]["nodes"] == len(root.all_nodes)
+        finally:
+            shutil.rmtree(os.path.dirname(trace_file), ignore_errors=True)
+
+
+@confoverrides(exhale_args={"memoryProfileFile": "_memory/exhale.txt"})
+class MemoryProfileTests(ExhaleTestCase):
+    """
+    Verify :data:`~exhale.configs.memoryProfileFile` profiles every phase.
+    """
+
+    test_project = "cpp_nesting"
+    """
+    .. testproject:: cpp_nesting
+
+    .. note::
+
+        The ``cpp_nesting`` project is just being recycled, the tests for that project
+        take place in
+        :class:`CPPNesting <testing.tests.cpp_nesting.CPPNesting>`.
+    """
+
+    def test_memory_profile(self):
+        """Every phase records its memory, and the summary lists them."""
+        memory_file = configs.memoryProfileFile
+        try:
+            root = get_exhale_root(self)
+            assert root.metrics.memory is None
+            assert not tracemalloc.is_tracing()
+            for phase in root.metrics.phases:
+                if phase["name"].startswith("doxygen"):
+                    assert "traced_peak" not in phase
+                    continue
+                assert phase["traced_peak"] >= phase["traced_current"] > 0
+
+            with codecs.open(memory_file, "r", "utf-8") as written:
+                report = written.read()
+            assert "Exhale memory profile of [cpp_nesting]" in report
+            assert "Top allocation sites at the end of every phase:" in report
+            assert "\n  discoverAllNodes " in report
+        finally:
+            shutil.rmtree(os.path.dirname(memory_file), ignore_errors=True)
+
+
+class IOBudgetTests(ExhaleTestCase):
+    """
+    Verify the Doxygen XML read and parsed per document, and the I/O budget assertions.
+    """
+
+    test_project = "cpp_nesting"
+    """
+    .. testproject:: cpp_nesting
+
+    .. note::
+
+        The ``cpp_nesting`` project is just being recycled, the tests for that project
+        take place in
+        :class:`CPPNesting <testing.tests.cpp_nesting.CPPNesting>`.
+    """
+
+    def test_io_budget(self):
+        """Every document is parsed once, and only file documents are read twice."""
+        root = get_exhale_root(self)
+        documents = root.metrics.documents
+        assert documents["index.xml"]["opened"] == 1
+        assert documents["index.xml"]["parsed"] == 1
+        for counter, io in (("files_opened", "opened"), ("bytes_read", "bytes_read"),
+                            ("documents_parsed", "parsed")):
+            assert root.metrics.counters[counter] == sum(d[io] for d in documents.values())
+        assert all(sorted(d) == sorted(DOCUMENT_IO) for d in documents.values())
+
+        # fileRefDiscovery scans the text of the file documents before they are parsed.
+        file_documents = ["{0}.xml".format(f.refid) for f in root.files]
+        file_bytes = sum(documents[d]["bytes_read"] // 2 for d in file_documents)
+        root.metrics.assertIOBudget(max_opened=1, max_parsed=1, ignore=file_documents)
+        root.metrics.assertIOBudget(
+            max_opened=2, max_parsed=1, max_bytes_read=utils.doxygenXMLSize() + file_bytes
+        )
+
+        with pytest.raises(AssertionError) as exc_info:
+            root.metrics.assertIOBudget(max_opened=1, max_bytes_read=0)
+        message = str(exc_info.value)
+        assert "[{0}] was read 2 times (at most 1 allowed).".format(file_documents[0]) in message
+        assert "bytes were read (at most 0 allowed)." in message
+        assert root.metrics.ioViolations(max_parsed=0, ignore=list(documents)) == []
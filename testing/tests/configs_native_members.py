@@ -0,0 +1,78 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+"""
+Tests for :data:`~exhale.configs.nativeMemberRendering`.
+"""
+from __future__ import unicode_literals
+
+import os
+
+from exhale import utils
+
+from testing import get_exhale_root
+from testing.base import ExhaleTestCase
+from testing.decorators import confoverrides
+
+
+@confoverrides(exhale_args={"nativeMemberRendering": True})
+class NativeMemberRenderingTests(ExhaleTestCase):
+    """
+    Verify members are documented with the Sphinx domains rather than Breathe.
+    """
+
+    test_project = "cpp_func_overloads"
+    """
+    .. testproject:: cpp_func_overloads
+
+    .. note::
+
+        The ``cpp_func_overloads`` project is just being recycled, the tests for that
+        project take place in
+        :class:`CPPFuncOverloads <testing.tests.cpp_func_overloads.CPPFuncOverloads>`.
+    """
+
+    def test_native_directives(self):
+        """Every function page uses ``.. cpp:function::`` with a unique signature."""
+        root = get_exhale_root(self)
+        self.assertTrue(len(root.functions) > 0)
+        signatures = set()
+        for node in root.functions:
+            contents = self.contents_for_node(node)
+            self.assertTrue(".. _{0}:".format(node.refid) in contents)
+            self.assertFalse(".. {0}::".format(utils.kindAsBreatheDirective(node.kind)) in contents)
+            directives = [line for line in contents.splitlines() if line.startswith(".. cpp:function:: ")]
+            self.assertEqual(len(directives), 1, "{0} is not documented once.".format(node.name))
+            signatures.add(directives[0])
+
+        # Overloads resolve to their own <memberdef>, not whatever Breathe finds first.
+        self.assertEqual(len(signatures), len(root.functions))
+
+    def test_member_definitions_consumed(self):
+        """Every gathered ``<memberdef>`` is used by a document and then dropped."""
+        root = get_exhale_root(self)
+        self.assertTrue(len(root.member_definitions) > 0)
+        for refid, memberdef in root.member_definitions.items():
+            self.assertTrue(memberdef is None, "{0} was not rendered.".format(refid))
+
+    @confoverrides(exhale_args={"nativeMemberRendering": True, "onDemandGeneration": True})
+    def test_render_twice(self):
+        """A page rendered again (e.g., Sphinx reads it again) is the same."""
+        root = get_exhale_root(self)
+        containmentFolder = self.getAbsContainmentFolder()
+        self.assertTrue(len(root.functions) > 0)
+        for node in root.functions:
+            docname = utils.sphinxDocname(os.path.join(containmentFolder, node.file_name))
+            first = root.renderOnDemandDocument(docname)
+            self.assertTrue(first is not None, "{0} was not deferred.".format(docname))
+            self.assertTrue(".. cpp:function:: " in first)
+            self.assertEqual(first, root.renderOnDemandDocument(docname))
+
+    def test_build(self):
+        """The full build succeeds with the native directives."""
+        self.app.build()
+        self.assertTrue(os.path.isdir(self.app.doctreedir))
@@ -0,0 +1,126 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+"""
+Tests for :data:`~exhale.configs.nodeDataStore`.
+"""
+from __future__ import unicode_literals
+
+import codecs
+import json
+import os
+import tracemalloc
+
+import pytest
+
+from exhale import cli, configs, deploy
+from exhale.storage import SQLiteNodeDataStore, StoredSequence
+
+from testing import get_exhale_root
+from testing.base import ExhaleTestCase
+from testing.decorators import confoverrides
+from testing.synthetic import SyntheticProject
+
+
+@confoverrides(exhale_args={"nodeDataStore": "sqlite"})
+class NodeDataStoreTests(ExhaleTestCase):
+    """
+    Verify the ``"sqlite"`` store generates the same documents as ``"memory"``.
+    """
+
+    test_project = "cpp_func_overloads"
+    """
+    .. testproject:: cpp_func_overloads
+
+    .. note::
+
+        The ``cpp_func_overloads`` project is just being recycled, the tests for that
+        project take place in
+        :class:`CPPFuncOverloads <testing.tests.cpp_func_overloads.CPPFuncOverloads>`.
+    """
+
+    def generated_documents(self):
+        """Map every document in the ``containmentFolder`` to its contents."""
+        documents = {}
+        containment_folder = self.getAbsContainmentFolder()
+        for dirpath, _, filenames in os.walk(containment_folder):
+            for name in filenames:
+                path = os.path.join(dirpath, name)
+                with codecs.open(path, "r", "utf-8") as document:
+                    documents[os.path.relpath(path, containment_folder)] = document.read()
+        return documents
+
+    def test_same_documents(self):
+        """Stored sequences are used, and generating in memory changes nothing."""
+        root = get_exhale_root(self)
+        assert isinstance(root.storage, SQLiteNodeDataStore)
+        assert len(root.parsed_xml) == 0
+        assert any(isinstance(f.parameters, StoredSequence) for f in root.functions)
+        assert any(isinstance(f.includes, StoredSequence) for f in root.files)
+        # Every document was generated, the database is gone.
+        assert not os.path.exists(root.storage.path)
+
+        sqlite_documents = self.generated_documents()
+        assert len(sqlite_documents) > 0
+        try:
+            configs.nodeDataStore = "memory"
+            deploy.explode()
+        finally:
+            configs.nodeDataStore = "sqlite"
+        self.assertEqual(sqlite_documents, self.generated_documents())
+
+
+@pytest.mark.skipif(not hasattr(os, "fork"), reason="os.fork is not available")
+def test_sqlite_store_fork():
+    """A forked process (e.g., a parallel read worker) reads through its own connection."""
+    store = SQLiteNodeDataStore()
+    includes = store.sequence("includes", "file_a", ["a.hpp", "b.hpp"])
+    store.commit()
+    parent_connection = store.connection
+
+    pid = os.fork()
+    if pid == 0:  # pragma: no cover (the child reports through its exit code)
+        ok = list(includes) == ["a.hpp", "b.hpp"]
+        ok = ok and store.connection is not parent_connection
+        store.close()  # only the parent removes the database
+        os._exit(0 if ok and os.path.isfile(store.path) else 1)
+    _, status = os.waitpid(pid, 0)
+    assert os.WIFEXITED(status) and os.WEXITSTATUS(status) == 0
+
+    assert store.connection is parent_connection
+    assert list(includes) == ["a.hpp", "b.hpp"]
+    store.close()
+    assert not os.path.exists(store.path)
+
+
+def test_sqlite_store_memory(tmp_path):
+    """
+    The peak memory of generating a synthetic project with long program listings is
+    lower with the ``"sqlite"`` store.  Only the data it holds moves out of memory, the
+    nodes and the graph are the same either way.
+    """
+    project = SyntheticProject(namespace_depth=2, namespace_fanout=4, program_listing_lines=600)
+    xml_dir = str(tmp_path / "xml")
+    project.write(xml_dir)
+    peaks = {}
+    for store in ("memory", "sqlite"):
+        config = tmp_path / "{0}.json".format(store)
+        config.write_text(json.dumps({"exhale_args": {
+            "containmentFolder": "./api_{0}".format(store),
+            "rootFileName": "synthetic_root.rst",
+            "doxygenStripFromPath": ".",
+            "exhaleExecutesDoxygen": False,
+            "nodeDataStore": store
+        }}))
+        configs._the_app = None  # release the previous root before measuring
+        tracemalloc.start()
+        try:
+            assert cli.main(["--config", str(config), "--xml-dir", xml_dir]) == 0
+            peaks[store] = tracemalloc.get_traced_memory()[1]
+        finally:
+            tracemalloc.stop()
+    assert peaks["sqlite"] < peaks["memory"], peaks
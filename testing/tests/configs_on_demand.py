@@ -0,0 +1,139 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+"""
+Tests for :data:`~exhale.configs.onDemandGeneration`.
+"""
+from __future__ import unicode_literals
+
+import os
+
+from exhale import configs, metrics, utils
+
+from testing import get_exhale_root
+from testing.base import ExhaleTestCase
+from testing.decorators import confoverrides
+
+
+@confoverrides(exhale_args={"onDemandGeneration": True})
+class OnDemandGenerationTests(ExhaleTestCase):
+    """
+    Verify documents are placeholders on disk and rendered when Sphinx reads them.
+    """
+
+    test_project = "cpp_nesting"
+    """
+    .. testproject:: cpp_nesting
+
+    .. note::
+
+        The ``cpp_nesting`` project is just being recycled, the tests for that project
+        take place in
+        :class:`CPPNesting <testing.tests.cpp_nesting.CPPNesting>`.
+    """
+
+    def test_placeholders(self):
+        """Every node document is a placeholder that renders to the real document."""
+        root = get_exhale_root(self)
+        self.assertTrue(len(root.on_demand_documents) > 0)
+        containmentFolder = self.getAbsContainmentFolder()
+        for node in root.all_nodes:
+            if node.kind in {"enumvalue", "group"} or not node.file_name.endswith(".rst"):
+                continue
+            contents = self.contents_for_node(node)
+            self.assertTrue(contents.startswith(".. exhale: generated on demand"))
+
+            docname = utils.sphinxDocname(os.path.join(containmentFolder, node.file_name))
+            rendered = root.renderOnDemandDocument(docname)
+            self.assertTrue(rendered is not None, "{0} was not deferred.".format(docname))
+            self.assertTrue(".. _{0}:".format(node.link_name) in rendered)
+            if node.kind in utils.LEAF_LIKE_KINDS:
+                self.assertTrue(".. {0}::".format(utils.kindAsBreatheDirective(node.kind)) in rendered)
+
+    def test_placeholders_metrics(self):
+        """Rendering a document after the build is counted by the root's metrics."""
+        root = get_exhale_root(self)
+        self.assertTrue(metrics.current() is not root.metrics)
+        counters = dict(root.metrics.counters)
+        docname = next(iter(root.on_demand_documents))
+        rendered = root.renderOnDemandDocument(docname)
+        self.assertEqual(root.metrics.counters["pages_written"], counters["pages_written"] + 1)
+        self.assertEqual(
+            root.metrics.counters["bytes_written"], counters["bytes_written"] + len(rendered.encode("utf-8"))
+        )
+        self.assertEqual(metrics.current().counters["pages_written"], 0)
+
+    def test_placeholders_unchanged(self):
+        """Placeholders are not rewritten when the Doxygen XML has not changed."""
+        root = get_exhale_root(self)
+        containmentFolder = self.getAbsContainmentFolder()
+        before = {}
+        for docname in root.on_demand_documents:
+            path = os.path.join(containmentFolder, os.path.basename(docname) + ".rst")
+            before[path] = os.stat(path).st_mtime_ns
+
+        # Clear the registry and defer again with the same graph.
+        root.on_demand_documents = {}
+        for node in root.all_nodes:
+            root.initializeNodeFilenameAndLink(node)
+        root.deferNodeDocuments()
+        for path, mtime in before.items():
+            self.assertEqual(os.stat(path).st_mtime_ns, mtime)
+
+    def test_placeholders_dependencies(self):
+        """Placeholders change with the configuration, and with the other nodes they show."""
+        root = get_exhale_root(self)
+        containmentFolder = self.getAbsContainmentFolder()
+
+        def placeholders():
+            root.on_demand_documents = {}
+            for node in root.all_nodes:
+                root.initializeNodeFilenameAndLink(node)
+            root.deferNodeDocuments()
+            contents = {}
+            for docname in root.on_demand_documents:
+                path = os.path.join(containmentFolder, os.path.basename(docname) + ".rst")
+                with open(path) as placeholder:
+                    contents[path] = placeholder.read()
+            return contents
+
+        original = placeholders()
+        native = configs.nativeMemberRendering
+        try:
+            configs.nativeMemberRendering = not native
+            changed = placeholders()
+            for path, contents in original.items():
+                self.assertNotEqual(changed[path], contents)
+        finally:
+            configs.nativeMemberRendering = native
+        self.assertEqual(placeholders(), original)
+
+        # A renamed child changes the title and link its parent shows.
+        parent = next(n for n in root.all_nodes if n.kind == "namespace" and n.children)
+        child = parent.children[0]
+        name = child.name
+        try:
+            child.name = name + "_renamed"
+            changed = placeholders()
+            parent_path = os.path.join(containmentFolder, parent.file_name)
+            self.assertNotEqual(changed[parent_path], original[parent_path])
+            # Pages not showing the child keep their placeholder.
+            other = next(
+                n for n in root.all_nodes
+                if n.kind in utils.LEAF_LIKE_KINDS and n is not child and n.parent is not child and
+                child not in n.children and child.parent is not n and child.def_in_file is not n
+            )
+            other_path = os.path.join(containmentFolder, other.file_name)
+            self.assertEqual(changed[other_path], original[other_path])
+        finally:
+            child.name = name
+        self.assertEqual(placeholders(), original)
+
+    def test_build(self):
+        """The full build succeeds with documents rendered in ``source-read``."""
+        self.app.build()
+        self.assertTrue(os.path.isdir(self.app.doctreedir))
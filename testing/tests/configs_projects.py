@@ -0,0 +1,212 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+"""
+Tests for generating every project in ``exhale_projects``.
+"""
+from __future__ import unicode_literals
+
+import codecs
+import json
+import os
+import pickle
+import shutil
+import threading
+from types import SimpleNamespace
+
+from exhale import cli, configs, deploy
+
+from testing import get_exhale_root
+from testing.base import ExhaleTestCase
+from testing.decorators import confoverrides
+from testing.synthetic import SyntheticProject, doxygenRefid
+
+
+@confoverrides(
+    breathe_projects={"nesting_copy": "./_doxygen_copy/xml"},
+    exhale_projects={
+        "cpp_nesting": {},
+        "nesting_copy": {
+            "containmentFolder": "./api_copy",
+            "rootFileName": "nesting_copy_root.rst"
+        }
+    }
+)
+class ExhaleProjectsTests(ExhaleTestCase):
+    """
+    Verify two projects are generated into their own ``containmentFolder``.
+    """
+
+    test_project = "cpp_nesting"
+    """
+    .. testproject:: cpp_nesting
+
+    .. note::
+
+        The ``cpp_nesting`` project is just being recycled (as two projects), the tests
+        for that project take place in
+        :class:`CPPNesting <testing.tests.cpp_nesting.CPPNesting>`.
+    """
+
+    def copy_folder(self, name):
+        """Return the absolute path of ``name`` for the ``nesting_copy`` project."""
+        return os.path.abspath(os.path.join(self.app.srcdir, name))
+
+    def test_both_projects(self):
+        """The default project is in process, the copy is labeled and directed apart."""
+        api_copy = self.copy_folder("api_copy")
+        try:
+            # The configuration of breathe_default_project stays active.
+            root = get_exhale_root(self)
+            assert configs._breathe_project == "cpp_nesting"
+            assert configs.containmentFolder == self.getAbsContainmentFolder()
+            for node in root.class_like:
+                assert node.link_name.startswith("exhale_")
+
+            assert os.path.isfile(os.path.join(api_copy, "nesting_copy_root.rst"))
+            copies = [name for name in os.listdir(api_copy) if name.startswith("class")]
+            assert len(copies) > 0
+            for name in copies:
+                with open(os.path.join(api_copy, name)) as copy:
+                    contents = copy.read()
+                assert ".. _nesting_copy_exhale_class" in contents
+                assert ":project: nesting_copy" in contents
+        finally:
+            for name in ("api_copy", "_doxygen_copy"):
+                if os.path.isdir(self.copy_folder(name)):
+                    shutil.rmtree(self.copy_folder(name))
+
+    @confoverrides(exhale_args={"traceFile": "_trace/exhale.json"})
+    def test_trace(self):
+        """Both projects are traced into one file, the copy on its worker's track."""
+        try:
+            get_exhale_root(self)
+            with codecs.open(configs.traceFile, "r", "utf-8") as written:
+                events = json.load(written)["traceEvents"]
+            spans = [e for e in events if e["ph"] == "X"]
+            projects = {e["name"]: e for e in spans if e["cat"] in ("project", "worker")}
+            in_process = projects["project cpp_nesting"]
+            worker = projects["project nesting_copy"]
+            assert in_process["cat"] == "project"
+            assert worker["cat"] == "worker"
+            assert worker["pid"] != in_process["pid"]
+            for pid in (in_process["pid"], worker["pid"]):
+                names = [e["name"] for e in spans if e["pid"] == pid]
+                for name in ("doxygen subprocess", "parse", "generateFullAPI"):
+                    assert name in names
+            assert any(e["ph"] == "M" and e["pid"] == worker["pid"] for e in events)
+        finally:
+            shutil.rmtree(os.path.dirname(configs.traceFile), ignore_errors=True)
+            for name in ("api_copy", "_doxygen_copy"):
+                if os.path.isdir(self.copy_folder(name)):
+                    shutil.rmtree(self.copy_folder(name))
+
+
+def test_project_configs_pickle(monkeypatch):
+    """Workers are sent the configuration of their project, without the Sphinx application."""
+    monkeypatch.setattr(configs, "_the_app", threading.Lock())
+    monkeypatch.setattr(configs, "containmentFolder", "/docs/api_copy")
+    project_configs = configs.ProjectConfigs("nesting_copy")
+    sent = pickle.loads(pickle.dumps(project_configs))
+    assert sent.project == "nesting_copy"
+    assert sent.values["_the_app"] is None
+    assert sent.values["containmentFolder"] == "/docs/api_copy"
+    assert project_configs.values["_the_app"] is configs._the_app
+
+
+def test_project_links(tmp_path):
+    """
+    An ``#include`` of a file and a base class documented by another project link to
+    its documents.  The ``io`` project only has the namespace ``n0_0``, it includes a
+    header of and derives from a class in ``n0_1`` of the ``core`` project.
+    """
+    xml_dirs = {"core": str(tmp_path / "core"), "io": str(tmp_path / "io")}
+    SyntheticProject(namespace_depth=1, namespace_fanout=2).write(xml_dirs["core"])
+    SyntheticProject(namespace_depth=1, namespace_fanout=1).write(xml_dirs["io"])
+
+    def edit(refid, old, new):
+        path = os.path.join(xml_dirs["io"], refid + ".xml")
+        with codecs.open(path, "r", "utf-8") as document:
+            contents = document.read()
+        assert old in contents
+        with codecs.open(path, "w", "utf-8") as document:
+            document.write(contents.replace(old, old + new, 1))
+
+    edit(
+        doxygenRefid("", "n0_0/header0.hpp"), '<includes local="no">vector</includes>\n',
+        '    <includes local="no">n0_1/header0.hpp</includes>\n'
+    )
+    edit(
+        doxygenRefid("class", "n0_0::Widget1"), "<compoundname>n0_0::Widget1</compoundname>\n",
+        '    <basecompoundref prot="public" virt="non-virtual">n0_1::Widget0</basecompoundref>\n'
+    )
+
+    config = tmp_path / "conf.json"
+    config.write_text(json.dumps({
+        "breathe_projects": xml_dirs,
+        "breathe_default_project": "core",
+        "exhale_args": {
+            "rootFileName": "root.rst",
+            "doxygenStripFromPath": ".",
+            "exhaleExecutesDoxygen": False
+        },
+        "exhale_projects": {
+            "core": {"containmentFolder": "./api_core"},
+            "io": {"containmentFolder": "./api_io"}
+        }
+    }))
+    assert cli.main(["--config", str(config)]) == 0
+
+    def generated(name):
+        with codecs.open(str(tmp_path / "api_io" / name), "r", "utf-8") as document:
+            return document.read()
+
+    assert "- ``n0_1/header0.hpp`` (:ref:`file_include_n0_1_header0.hpp`)" in \
+        generated("io_file_include_n0_0_header0.hpp.rst")
+    assert "- ``public n0_1::Widget0`` (:ref:`exhale_class_classn0__1_1_1Widget0`)" in \
+        generated("classn0__0_1_1Widget1.rst")
+    # What the io project documents itself keeps linking to its own (prefixed) labels.
+    assert "(:ref:`io_file_include_n0_0_header0.hpp`)" in generated("io_file_include_n0_0_header1.hpp.rst")
+
+
+def test_project_files(tmp_path, monkeypatch):
+    """
+    ``{project}`` in the files written about the build is replaced with the project, the
+    projects writing one file are warned about.
+    """
+    xml_dirs = {"core": str(tmp_path / "core"), "io": str(tmp_path / "io")}
+    SyntheticProject(namespace_depth=1, namespace_fanout=2).write(xml_dirs["core"])
+    SyntheticProject(namespace_depth=1, namespace_fanout=1).write(xml_dirs["io"])
+    warnings = []
+    monkeypatch.setattr(deploy, "logger", SimpleNamespace(
+        info=lambda msg: None, warning=lambda msg, **kwargs: warnings.append(msg)
+    ))
+
+    def build(exhale_args):
+        exhale_args.update(rootFileName="root.rst", doxygenStripFromPath=".", exhaleExecutesDoxygen=False)
+        config = tmp_path / "conf.json"
+        config.write_text(json.dumps({
+            "breathe_projects": xml_dirs,
+            "breathe_default_project": "core",
+            "exhale_args": exhale_args,
+            "exhale_projects": {
+                "core": {"containmentFolder": "./api_core"},
+                "io": {"containmentFolder": "./api_io"}
+            }
+        }))
+        assert cli.main(["--config", str(config)]) == 0
+
+    build({"metricsFile": "_build/{project}-metrics.json"})
+    for project in ("core", "io"):
+        metrics = str(tmp_path / "_build" / "{0}-metrics.json".format(project))
+        with codecs.open(metrics, "r", "utf-8") as written:
+            assert json.load(written)["project"] == project
+    assert warnings == []
+
+    build({"metricsFile": "_build/metrics.json"})
+    assert len(warnings) == 1
+    assert "'core' and 'io' write the same `metricsFile`" in warnings[0]
@@ -62,6 +62,28 @@ class CPPNesting(ExhaleTestCase):
             break
         compare_file_hierarchy(self, file_hierarchy(no_include))
 
+    @confoverrides(exhale_args={"exhaleDoxygenLean": True})
+    def test_hierarchies_lean(self):
+        """
+        Verify the class and file hierarchies with ``exhaleDoxygenLean=True``.
+
+        File ownership must be recovered without the ``<programlisting>``.
+        """
+        compare_class_hierarchy(self, class_hierarchy(self.class_hierarchy_dict()))
+        compare_file_hierarchy(self, file_hierarchy(self.file_hierarchy_dict()))
+        exhale_root = self.app.exhale_root
+        for f in exhale_root.files:
+            program_file = osp.join(exhale_root.root_directory, f.program_file)
+            assert not osp.isfile(program_file)
+
+    def test_released_after_generation(self):
+        """Parsed XML and program listings are dropped once the documents are written."""
+        exhale_root = self.app.exhale_root
+        assert len(exhale_root.parsed_xml) == 0
+        for f in exhale_root.files:
+            assert len(f.program_listing) == 0
+            assert osp.isfile(osp.join(exhale_root.root_directory, f.program_file))
+
 
 class CPPNestingPages(ExhaleTestCase):
     """
@@ -404,3 +404,16 @@ class CPPPimpl(ExhaleTestCase):
         self.validate_namespace_listings(TestedExclusionTypes.DetailImpl)
         self.validate_file_listings()
         self.checkAllFilesIncluded()
+
+    @confoverrides(exhale_args={"listingExclude": [r".*Impl$"], "listingExcludeDoxygen": True})
+    def test_impl_exclude_doxygen(self):
+        """
+        Verify ``listingExcludeDoxygen`` removes ``*Impl`` items from the graph entirely.
+        """
+        exhale_root = get_exhale_root(self)
+        assert not any(node.name.endswith("Impl") for node in exhale_root.all_nodes)
+        for f in exhale_root.files:
+            assert not any(child.name.endswith("Impl") for child in f.children)
+        assert not any(generated.endswith("Impl.rst") for generated in exhale_root.generatedDocuments())
+        self.validate_class_hierarchy(TestedExclusionTypes.AllImpl)
+        self.checkAllFilesIncluded()
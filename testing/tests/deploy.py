@@ -0,0 +1,98 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+"""
+Tests for following the output of Doxygen with :class:`exhale.deploy.DoxygenOutput`.
+"""
+from __future__ import unicode_literals
+
+from types import SimpleNamespace
+
+from exhale import deploy, metrics
+from exhale.deploy import DoxygenOutput
+
+
+def logged(monkeypatch):
+    """What :mod:`exhale.deploy` logs at the ``INFO`` level."""
+    messages = []
+    monkeypatch.setattr(deploy, "logger", SimpleNamespace(info=messages.append))
+    return messages
+
+
+def test_doxygen_phases(monkeypatch):
+    """Announced phases last until the next one, per-file progress is not a phase."""
+    messages = logged(monkeypatch)
+    output = DoxygenOutput(echo=False, progress=False)
+    for now, line in enumerate([
+        "Doxygen version used: 1.9.8\n",
+        "Searching for include files...\n",
+        "Parsing files\n",
+        "Preprocessing /include/a.hpp...\n",
+        "Parsing file /include/a.hpp...\n",
+        "Reading /include/a.md...\n",
+        "Building class list...\n",
+        "Generating XML output...\n",
+        "Generating XML output for class a\n",
+        "finished...\n"
+    ]):
+        output.stdoutLine(line, now=float(now))
+    output.finish(now=20.0)
+    assert output.phases == [
+        ("Searching for include files", 1.0, 2.0),
+        ("Parsing files", 2.0, 6.0),
+        ("Building class list", 6.0, 7.0),
+        ("Generating XML output", 7.0, 9.0)
+    ]
+    assert messages == []
+
+    # Without "finished...", the last phase lasts until Doxygen exits.
+    output = DoxygenOutput(echo=False)
+    output.stdoutLine("Parsing files", now=1.0)
+    output.finish(now=3.0)
+    assert output.phases == [("Parsing files", 1.0, 3.0)]
+    assert messages == ["Doxygen: Parsing files"]
+
+
+def test_doxygen_warnings(monkeypatch):
+    """Warnings are counted by category, only a bounded number are kept."""
+    messages = logged(monkeypatch)
+    metrics.reset()
+    output = DoxygenOutput(echo=False, max_categories=2, max_examples=3)
+    undocumented = "/include/a.hpp:{0}: warning: Member 'f{0}' (function) is not documented."
+    for i in range(5):
+        output.stderrLine(undocumented.format(i) + "\n")
+    output.stderrLine("/include/b.hpp:1: error: unable to resolve reference to `x' for \\ref command\n")
+    output.stderrLine("/include/c.hpp:2: warning: argument 'y' of command @param is not found\n")
+    output.stderrLine("Some other diagnostic without a level\n")
+
+    assert output.warnings == 7
+    assert metrics.current().counters["doxygen_warnings"] == 7
+    assert output.categories == {
+        "warning: Member ... (function) is not documented.": 5,
+        "error: unable to resolve reference to ... for \\ref command": 1,
+        "other": 1
+    }
+    assert output.examples == [undocumented.format(i) for i in range(3)]
+    output.finish()
+    summary = output.summary(top=1)
+    assert "7 warning(s), most common:" in summary
+    assert "5  warning: Member ... (function) is not documented." in summary
+    assert "error:" not in summary
+    assert messages == []
+    metrics.reset()
+
+
+def test_doxygen_echo(monkeypatch):
+    """Echoed Doxygen output is logged at the ``INFO`` level, never as a Sphinx warning."""
+    messages = logged(monkeypatch)
+    output = DoxygenOutput(echo=True)
+    output.stdoutLine("Parsing files\n", now=1.0)
+    output.stderrLine("/include/a.hpp:1: warning: Member 'f' (function) is not documented.\n")
+    output.finish(now=2.0)
+    assert messages[0] == "Parsing files"
+    assert messages[1].endswith("/include/a.hpp:1: warning: Member 'f' (function) is not documented.")
+    assert len(messages) == 2
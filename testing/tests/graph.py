@@ -0,0 +1,139 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+"""
+Tests for validating parts of :mod:`exhale.graph`.
+"""
+from __future__ import unicode_literals
+
+import os
+
+from exhale import configs, utils
+from exhale.graph import ExhaleNode, ExhaleRoot
+
+from testing.synthetic import SyntheticProject
+
+
+def test_included_file(tmp_path, monkeypatch):
+    """
+    Tests for :func:`~exhale.graph.ExhaleRoot.includedFile`, an ``#include`` links to the
+    file whose location ends with it, even when another file sorted first contains it.
+    """
+    monkeypatch.setattr(configs, "containmentFolder", str(tmp_path))
+    monkeypatch.setattr(configs, "rootFileName", "library_root.rst")
+    root = ExhaleRoot()
+    # The layout of the cpp_nesting project, "nested/one/one.hpp" is also a substring
+    # of the location of the dual_nested header sorted before it.
+    for location in sorted([
+        "include/nested/one/one.hpp",
+        "include/nested/dual_nested/one/one.hpp",
+        "include/top_level.hpp"
+    ]):
+        node = ExhaleNode(os.path.basename(location), "file", location.replace("/", "_"))
+        node.location = os.path.normpath(location)
+        root.initializeNodeFilenameAndLink(node)
+        root.files.append(node)
+
+    assert root.includedFile("nested/one/one.hpp").link_name == "file_include_nested_one_one.hpp"
+    assert root.includedFile("nested/dual_nested/one/one.hpp").link_name == \
+        "file_include_nested_dual_nested_one_one.hpp"
+    assert root.includedFile("top_level.hpp").link_name == "file_include_top_level.hpp"
+    # Without a file ending with it, the first file containing it.
+    assert root.includedFile("dual_nested").link_name == "file_include_nested_dual_nested_one_one.hpp"
+    assert root.includedFile("vector") is None
+    root.storage.close()
+
+
+def test_node_slots():
+    """Every slot of an :class:`~exhale.graph.ExhaleNode` is set, whatever its kind."""
+    for kind in utils.AVAILABLE_KINDS + ["unknown"]:
+        node = ExhaleNode("name", kind, "refid")
+        for slot in ExhaleNode.__slots__:
+            getattr(node, slot)
+        assert node.location == "" and node.parameters == ()
+        assert (node.program_file == "") == (kind == "file")
+
+
+def test_project_configs(tmp_path, monkeypatch):
+    """
+    An :class:`~exhale.graph.ExhaleRoot` reads the configuration it was given, not the
+    variables of :mod:`exhale.configs` (which may belong to another project by then).
+    """
+    monkeypatch.setattr(configs, "containmentFolder", str(tmp_path / "api_io"))
+    monkeypatch.setattr(configs, "rootFileName", "io_root.rst")
+    monkeypatch.setattr(configs, "_link_name_prefix", "io_")
+    project_configs = configs.ProjectConfigs("io")
+    monkeypatch.setattr(configs, "containmentFolder", str(tmp_path / "api"))
+    monkeypatch.setattr(configs, "_link_name_prefix", "")
+
+    root = ExhaleRoot(project_configs)
+    assert root.configs.containmentFolder == str(tmp_path / "api_io")
+    assert root.full_root_file_path == str(tmp_path / "api_io" / "io_root.rst")
+    node = ExhaleNode("n0_0::Widget0", "class", "classn0__0_1_1Widget0")
+    root.initializeNodeFilenameAndLink(node)
+    assert node.link_name == "io_exhale_class_classn0__0_1_1Widget0"
+    assert node.file_name == str(tmp_path / "api_io" / "classn0__0_1_1Widget0.rst")
+    root.storage.close()
+
+
+def test_project_link(tmp_path, monkeypatch):
+    """
+    Tests for :func:`~exhale.graph.ExhaleRoot.projectLink`, names are resolved against
+    the link index of the other projects in order.
+    """
+    monkeypatch.setattr(configs, "containmentFolder", str(tmp_path))
+    monkeypatch.setattr(configs, "rootFileName", "library_root.rst")
+    root = ExhaleRoot(project_links={
+        "core": {
+            "files": {os.path.normpath("include/core/base.hpp"): "core_file_include_core_base.hpp"},
+            "compounds": {"core::Base": "core_exhale_class_classcore_1_1Base"}
+        },
+        "io": {
+            "files": {os.path.normpath("include/io/base.hpp"): "io_file_include_io_base.hpp"},
+            "compounds": {"io::detail::Base": "io_exhale_class_classio_1_1detail_1_1Base"}
+        }
+    })
+    assert root.projectLink("files", "core/base.hpp") == "core_file_include_core_base.hpp"
+    assert root.projectLink("files", "io/base.hpp") == "io_file_include_io_base.hpp"
+    assert root.projectLink("files", "base.hpp") == "core_file_include_core_base.hpp"
+    assert root.projectLink("files", "vector") is None
+    assert root.projectLink("compounds", "core::Base< int >") == "core_exhale_class_classcore_1_1Base"
+    # Unqualified names are looked up in the scopes enclosing the derived class.
+    assert root.projectLink("compounds", "Base", "io::detail::Reader") == \
+        "io_exhale_class_classio_1_1detail_1_1Base"
+    assert root.projectLink("compounds", "Base", "io::Reader") is None
+    root.storage.close()
+
+
+def test_retained_parsed_xml(tmp_path, monkeypatch):
+    """
+    Once parsed, only the descriptions of the file and namespace documents are kept (see
+    :func:`~exhale.graph.ExhaleRoot.retainParsedXML`), and native rendering parses the
+    documents it needs again.
+    """
+    xml_dir = str(tmp_path / "xml")
+    SyntheticProject(namespace_depth=2, namespace_fanout=2).write(xml_dir)
+    monkeypatch.setattr(configs, "_doxygen_xml_output_directory", xml_dir)
+    monkeypatch.setattr(configs, "containmentFolder", str(tmp_path / "api"))
+    monkeypatch.setattr(configs, "rootFileName", "library_root.rst")
+    monkeypatch.setattr(configs, "doxygenStripFromPath", str(tmp_path))
+    monkeypatch.setattr(configs, "nativeMemberRendering", True)
+    root = ExhaleRoot()
+    root.parse()
+
+    assert set(root.parsed_xml) == set(n.refid for n in root.all_nodes if n.kind in ("file", "namespace"))
+    assert root.partial_xml == set(root.parsed_xml)
+    for soup in root.parsed_xml.values():
+        children = soup.doxygen.compounddef.find_all(True, recursive=False)
+        assert set(child.name for child in children) <= {"briefdescription", "detaileddescription"}
+    # The signatures were parsed before the functions were dropped.
+    assert all(len(f.parameters) > 0 for f in root.functions)
+
+    function = root.functions[0]
+    memberdef = root.memberDefinition(function)
+    assert memberdef is not None and memberdef.attrs["id"] == function.refid
+    root.storage.close()
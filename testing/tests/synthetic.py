@@ -0,0 +1,90 @@
+# -*- coding: utf8 -*-
+########################################################################################
+# This file is part of exhale.  Copyright (c) 2017-2024, Stephen McDowell.             #
+# Full BSD 3-Clause license available here:                                            #
+#                                                                                      #
+#                https://github.com/svenevs/exhale/blob/master/LICENSE                 #
+########################################################################################
+"""
+Tests for the synthetic Doxygen XML of :mod:`testing.synthetic`.
+"""
+from __future__ import unicode_literals
+
+import collections
+import json
+import os
+import xml.etree.ElementTree as ElementTree
+
+from exhale import cli, configs
+
+from testing.synthetic import SyntheticProject, doxygenRefid
+
+
+def test_doxygen_refid():
+    """Names are escaped as Doxygen escapes them."""
+    assert doxygenRefid("namespace", "n0_1::n1_0") == "namespacen0__1_1_1n1__0"
+    assert doxygenRefid("class", "n0::Widget< int >") == "classn0_1_1Widget_3_01int_01_4"
+    assert doxygenRefid("", "n0/header0.hpp") == "n0_2header0_8hpp"
+
+
+def test_synthetic_index(tmp_path):
+    """Every compound in ``index.xml`` has a document, and every reference resolves."""
+    project = SyntheticProject(namespace_depth=2, namespace_fanout=2, template_specializations=9)
+    xml_dir = str(tmp_path / "xml")
+    compounds = project.write(xml_dir)
+
+    index = ElementTree.parse(os.path.join(xml_dir, "index.xml")).getroot()
+    refids = set()
+    kinds = collections.Counter()
+    for compound in index.findall("compound"):
+        refids.add(compound.get("refid"))
+        kinds[compound.get("kind")] += 1
+        for member in compound.findall("member"):
+            if compound.get("kind") == "namespace":
+                kinds[member.get("kind")] += 1
+    assert compounds == len(refids)
+    assert dict(kinds) == project.counts()
+
+    for refid in refids:
+        document = ElementTree.parse(os.path.join(xml_dir, refid + ".xml")).getroot()
+        compounddef = document.find("compounddef")
+        assert compounddef.get("id") == refid
+        for inner in compounddef:
+            if inner.tag.startswith("inner") or inner.tag == "includedby":
+                assert inner.get("refid") in refids
+
+    # The same parameters write the same documents.
+    again = str(tmp_path / "again")
+    project.write(again)
+    for name in os.listdir(xml_dir):
+        with open(os.path.join(xml_dir, name)) as first, open(os.path.join(again, name)) as second:
+            assert first.read() == second.read()
+
+
+def test_synthetic_exhale(tmp_path):
+    """Exhale finds every compound and function, in the file and directory they are in."""
+    project = SyntheticProject(namespace_depth=2, namespace_fanout=2, template_specializations=2)
+    xml_dir = str(tmp_path / "xml")
+    project.write(xml_dir)
+    config = tmp_path / "exhale.json"
+    config.write_text(json.dumps({"exhale_args": {
+        "containmentFolder": "./api",
+        "rootFileName": "synthetic_root.rst",
+        "doxygenStripFromPath": ".",
+        "exhaleExecutesDoxygen": False
+    }}))
+    assert cli.main(["--config", str(config), "--xml-dir", xml_dir]) == 0
+
+    root = configs._the_app.exhale_root
+    # Exhale keeps a node for every listing of a function in index.xml (the namespace and
+    # the file), count what was found rather than the nodes.
+    found = set((node.kind, node.refid) for node in root.all_nodes)
+    assert dict(collections.Counter(kind for kind, _ in found)) == project.counts()
+    for node in root.all_nodes:
+        if node.kind in ("class", "function") and root.node_by_refid[node.refid] is node:
+            assert node.def_in_file is not None
+            assert node.def_in_file.location.startswith("include/")
+        elif node.kind == "file":
+            assert node.parent is not None and node.parent.kind == "dir"
+            assert len(node.program_listing) == 0  # released after it was written
+    assert os.path.isfile(os.path.join(str(tmp_path), "api", "synthetic_root.rst"))
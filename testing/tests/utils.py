@@ -8,11 +8,24 @@
 """
 Tests for validating parts of :mod:`exhale.utils`.
 """
+import io
+import os
 import re
+import tarfile
+import zipfile
 
-from exhale.utils import join_template_tokens, tokenize_template
+from exhale import cli, configs
+from exhale.utils import AVAILABLE_KINDS, KIND_DIRECTIVES, KIND_QUALIFIERS, KIND_SORT_RANK, Kind, \
+    CombinedCompounds, detachSharedFile, doxygenExcludeSymbol, doxygenXMLArchive, doxygenXMLDocuments, \
+    forgetDoxygenXML, hasDoxygenXML, isDoxygenXMLArchive, iterCombinedCompounds, join_template_tokens, \
+    kindAsBreatheDirective, kindCode, listingExcluded, nodeCompoundXMLContents, parentScope, qualifyKind, \
+    readDoxygenXML, resetVerboseLog, storeDocument, tokenize_template, verbose_log
 
+from testing.synthetic import SyntheticProject
+
+from lxml import etree
 import pytest
+from sphinx.errors import ConfigError
 
 templates = [
     # Special case: empty list is returned for empty string.
@@ -136,3 +149,291 @@ def test_join_template_tokens_edge_cases():
     exc_info.match(re.escape(
         "The first token must be a string, but the type of tokens[0] is <class "
         "'list'>."))
+
+
+def test_store_document(tmp_path):
+    """
+    Tests for :func:`~exhale.utils.storeDocument` and
+    :func:`~exhale.utils.detachSharedFile`.
+    """
+    store = str(tmp_path / "store")
+    first = tmp_path / "v1.rst"
+    second = tmp_path / "v2.rst"
+    first.write_text("same\n")
+    second.write_text("same\n")
+
+    # Documents are linked the first time, even without a previous manifest (e.g., a
+    # fresh checkout sharing the store).
+    digest = storeDocument(str(first), store)
+    stored = os.path.join(store, "objects", digest[:2], digest[2:])
+    assert os.path.isfile(stored)
+    assert os.path.samefile(str(first), stored)
+    assert storeDocument(str(second), store) == digest
+    assert os.path.samefile(str(second), stored)
+    assert os.stat(stored).st_nlink == 3
+    # Storing again is a no-op.
+    assert storeDocument(str(first), store, digest) == digest
+
+    # Detaching keeps the stored object intact.
+    detachSharedFile(str(first), keep_contents=True)
+    assert not os.path.samefile(str(first), stored)
+    assert first.read_text() == "same\n"
+    detachSharedFile(str(second))
+    assert not second.exists()
+    with open(stored) as f:
+        assert f.read() == "same\n"
+
+
+def test_store_document_revert(tmp_path):
+    """
+    A document changed to contents already in the store (A -> B -> A) is linked, and is
+    newer than the environment of the previous build, so Sphinx re-reads it.
+    """
+    store = str(tmp_path / "store")
+    page = tmp_path / "page.rst"
+    past = 1000000000
+
+    # Build 1 writes A (and links it), as if it ran long ago.
+    page.write_text("A\n")
+    digest_a = storeDocument(str(page), store)
+    stored_a = os.path.join(store, "objects", digest_a[:2], digest_a[2:])
+    assert os.path.samefile(str(page), stored_a)
+    os.utime(stored_a, (past, past))
+
+    # Build 2 generates A again, it keeps the stored time so Sphinx does not re-read it.
+    detachSharedFile(str(page))
+    page.write_text("A\n")
+    assert storeDocument(str(page), store, digest_a) == digest_a
+    assert os.path.samefile(str(page), stored_a)
+    assert os.stat(str(page)).st_mtime == past
+
+    # Build 3 changes the page to B (generating detaches it from the store first).
+    detachSharedFile(str(page))
+    page.write_text("B\n")
+    digest_b = storeDocument(str(page), store, digest_a)
+    assert digest_b != digest_a
+    environment = past + 10  # Sphinx wrote its environment after reading B
+    assert os.stat(str(page)).st_mtime > environment
+    assert os.stat(stored_a).st_mtime == past
+
+    # Build 4 reverts the page to A, which the store has with its old time.
+    detachSharedFile(str(page))
+    page.write_text("A\n")
+    assert storeDocument(str(page), store, digest_b) == digest_a
+    assert os.path.samefile(str(page), stored_a)
+    assert os.stat(str(page)).st_mtime > environment  # Sphinx re-reads it
+    with open(stored_a) as f:
+        assert f.read() == "A\n"
+
+
+@pytest.mark.parametrize("suffix,mode", [
+    (".zip", None), (".tar", "w"), (".tar.gz", "w:gz"), (".tar.bz2", "w:bz2"), (".tar.xz", "w:xz")
+])
+def test_doxygen_xml_archive(tmp_path, monkeypatch, suffix, mode):
+    """
+    Tests for :class:`~exhale.utils.DoxygenXMLArchive` and
+    :func:`~exhale.utils.readDoxygenXML`.
+    """
+    documents = {"xml/index.xml": "<doxygenindex/>", "xml/a.xml": "<doxygen/>", "README": "x"}
+    archive_path = str(tmp_path / "doxygen{0}".format(suffix))
+    if mode is None:
+        with zipfile.ZipFile(archive_path, "w") as archive:
+            for name, contents in documents.items():
+                archive.writestr(name, contents)
+    else:
+        with tarfile.open(archive_path, mode) as archive:
+            for name, contents in documents.items():
+                data = contents.encode("utf-8")
+                info = tarfile.TarInfo(name)
+                info.size = len(data)
+                archive.addfile(info, io.BytesIO(data))
+
+    monkeypatch.setattr(configs, "_doxygen_xml_output_directory", archive_path)
+    assert isDoxygenXMLArchive(archive_path)
+    assert doxygenXMLArchive().names() == ["a.xml", "index.xml"]
+    assert hasDoxygenXML("index.xml")
+    assert readDoxygenXML("a.xml") == "<doxygen/>"
+    assert readDoxygenXML("missing.xml") is None
+
+    # Only the index is in memory, compressed tarballs are read from an uncompressed copy.
+    archive = doxygenXMLArchive()
+    assert not any(isinstance(member, bytes) for member in archive._members.values())
+    tar_path = archive.tar_path
+    assert (tar_path is not None) == (suffix not in (".zip", ".tar"))
+    forgetDoxygenXML()
+    assert tar_path is None or not os.path.exists(tar_path)
+    assert doxygenXMLArchive() is not archive
+    assert readDoxygenXML("index.xml") == "<doxygenindex/>"
+    forgetDoxygenXML()
+
+
+def test_doxygen_xml_documents(tmp_path, monkeypatch):
+    """
+    Tests for :func:`~exhale.utils.doxygenXMLDocuments` with ``CREATE_SUBDIRS = YES``.
+    """
+    (tmp_path / "d4" / "d2").mkdir(parents=True)
+    (tmp_path / "index.xml").write_text("<doxygenindex/>")
+    (tmp_path / "d4" / "d2" / "classfoo.xml").write_text("<doxygen>foo</doxygen>")
+    (tmp_path / "d4" / "d2" / "notes.txt").write_text("ignored")
+
+    monkeypatch.setattr(configs, "_doxygen_xml_output_directory", str(tmp_path))
+    assert doxygenXMLDocuments() == {"index.xml": "index.xml", "classfoo.xml": "d4/d2/classfoo.xml"}
+
+    class Node(object):
+        refid = "classfoo"
+
+    assert nodeCompoundXMLContents(Node()) == "<doxygen>foo</doxygen>"
+    Node.refid = "classbar"
+    assert nodeCompoundXMLContents(Node()) is None
+
+    # Running Doxygen again only modifies the sub-directory, forgetting finds it.
+    (tmp_path / "d4" / "d2" / "classbar.xml").write_text("<doxygen>bar</doxygen>")
+    assert nodeCompoundXMLContents(Node()) is None
+    forgetDoxygenXML()
+    assert nodeCompoundXMLContents(Node()) == "<doxygen>bar</doxygen>"
+
+
+def test_doxygen_xml_documents_breathe(tmp_path):
+    """
+    Sphinx builds with Breathe stop with a ``ConfigError`` on a ``CREATE_SUBDIRS = YES``
+    output, the standalone ``exhale`` command builds from it.
+    """
+    xml_dir = tmp_path / "xml"
+    (xml_dir / "d4" / "d2").mkdir(parents=True)
+    (xml_dir / "index.xml").write_text("<doxygenindex/>")
+    (xml_dir / "d4" / "d2" / "classfoo.xml").write_text("<doxygen>foo</doxygen>")
+
+    def apply(extensions):
+        configs._default_configs.activate()
+        app = cli.StandaloneApplication(str(tmp_path), str(tmp_path), {
+            "exhale_args": {"containmentFolder": "./api", "rootFileName": "root.rst",
+                            "doxygenStripFromPath": "."},
+            "breathe_projects": {"foo": str(xml_dir)},
+            "breathe_default_project": "foo"
+        })
+        app.extensions = extensions
+        configs.apply_sphinx_configurations(app)
+
+    try:
+        apply({})
+        with pytest.raises(ConfigError, match=r"d4/d2/classfoo\.xml"):
+            apply({"breathe": None})
+    finally:
+        configs._default_configs.activate()
+        forgetDoxygenXML()
+
+
+def test_iter_combined_compounds(tmp_path):
+    """
+    Tests for :func:`~exhale.utils.iterCombinedCompounds` on the output of Doxygen's
+    ``combine.xslt`` (every compound on one line), read in chunks of any size.
+    """
+    xml_dir = tmp_path / "xml"
+    compounds = SyntheticProject(namespace_depth=1, namespace_fanout=2).write(str(xml_dir))
+    combine = etree.XSLT(etree.parse(str(xml_dir / "combine.xslt")))
+    combined_path = str(tmp_path / "combined.xml")
+    contents = bytes(combine(etree.parse(str(xml_dir / "index.xml"))))
+    with open(combined_path, "wb") as combined:
+        combined.write(contents)
+
+    found = list(iterCombinedCompounds(combined_path))
+    assert len(found) == compounds
+    for offset, compounddef in found:
+        assert compounddef.startswith(b"<compounddef") and compounddef.endswith(b"</compounddef>")
+        assert contents[offset:offset + len(compounddef)] == compounddef
+    # Chunks shorter than the tags split them, and every element spans many chunks.
+    for chunk_size in (7, 13, 4096):
+        assert list(iterCombinedCompounds(combined_path, chunk_size)) == found
+
+    # Only the spans are kept, each compound is read back as its own document.
+    spans = CombinedCompounds(combined_path)
+    for offset, compounddef in found:
+        refid = etree.fromstring(compounddef).get("id")
+        spans.add(refid, offset, len(compounddef))
+    assert len(spans) == compounds
+    refid = etree.fromstring(found[-1][1]).get("id")
+    document = etree.fromstring(spans.get(refid).encode("utf-8"))
+    assert document.tag == "doxygen" and document[0].get("id") == refid
+    assert spans.pop(refid) == (found[-1][0], len(found[-1][1]))
+    assert spans.get(refid) is None
+    spans.close()
+
+
+@pytest.mark.parametrize("pattern,flags,expected", [
+    (r".*Impl$", 0, "*Impl$"),
+    (r".*detail::.*Impl$", 0, "*detail::*Impl$"),
+    (r"detail", 0, "^detail*"),
+    (r"^pimpl::Earth$", 0, "^pimpl::Earth$"),
+    (r".*impl$", re.IGNORECASE, None),
+    (r"[A-Z]+Impl", 0, None),
+    (r".*", 0, None)
+])
+def test_doxygen_exclude_symbol(pattern, flags, expected):
+    """
+    Tests for :func:`~exhale.utils.doxygenExcludeSymbol`.
+    """
+    assert doxygenExcludeSymbol(re.compile(pattern, flags)) == expected
+
+
+def test_listing_excluded(monkeypatch):
+    """
+    Tests for :func:`~exhale.utils.listingExcluded`, enclosing scopes are excluded too.
+    """
+    monkeypatch.setattr(configs, "_compiled_listing_exclude", [re.compile(r".*Impl$")])
+    assert listingExcluded("pimpl::EarthImpl")
+    assert listingExcluded("pimpl::EarthImpl::Nested")
+    assert not listingExcluded("pimpl::Earth")
+    # Template arguments are not an enclosing scope.
+    assert not listingExcluded("pimpl::Planet< pimpl::EarthImpl >::Nested")
+
+
+def test_verbose_log_replaced(tmp_path, monkeypatch):
+    """
+    Tests for :func:`~exhale.utils.resetVerboseLog`, each build replaces the file.
+    """
+    verbose_file = tmp_path / "exhale.log"
+    monkeypatch.setattr(configs, "verboseBuild", True)
+    monkeypatch.setattr(configs, "verboseBuildFile", str(verbose_file))
+    try:
+        resetVerboseLog()
+        verbose_log("first {0}", None, "build")
+        resetVerboseLog()
+        verbose_log("second {0}", None, "build")
+        # Other projects of the same build append to the file.
+        monkeypatch.setattr(configs, "verboseBuildFile", str(tmp_path / "other.log"))
+        verbose_log("other project")
+        monkeypatch.setattr(configs, "verboseBuildFile", str(verbose_file))
+        verbose_log("third project")
+    finally:
+        resetVerboseLog()
+    assert verbose_file.read_text(encoding="utf-8") == "second build\nthird project\n"
+
+
+def test_parent_scope():
+    """
+    Tests for :func:`~exhale.utils.parentScope`.
+    """
+    assert parentScope("outer::inner::Nested") == "outer::inner"
+    assert parentScope("outer::Nested") == "outer"
+    assert parentScope("Nested") is None
+    assert parentScope("::Nested") == ""
+
+
+def test_kind_tables():
+    """
+    Tests for :class:`~exhale.utils.Kind` and the tables indexed by it.
+    """
+    for kind in AVAILABLE_KINDS:
+        code = kindCode(kind)
+        assert code.name.lower() == kind
+        assert qualifyKind(kind) == KIND_QUALIFIERS[code]
+        assert kindAsBreatheDirective(kind) == KIND_DIRECTIVES[code] == "doxygen" + kind
+    assert qualifyKind("dir") == "Directory"
+    # Kinds exhale does not know about still get a qualifier and directive.
+    assert kindCode("example") == Kind.UNKNOWN
+    assert qualifyKind("example") == "Example"
+    assert kindAsBreatheDirective("example") == "doxygenexample"
+    # Structs, then classes, then everything else alphabetically.
+    ranked = sorted(AVAILABLE_KINDS, key=lambda kind: KIND_SORT_RANK[kindCode(kind)])
+    assert ranked[:2] == ["struct", "class"]
+    assert ranked[2:] == sorted(ranked[2:])